@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+
+"""
+Measure MAVLink FTP burst download throughput over UDP.
+
+Downloads a file from a running instance (e.g. SITL) with kCmdBurstReadFile
+in one or more parallel sessions and prints the throughput in MB/s.
+Missing offsets are re-requested, the same way ground stations do.
+
+Only the FILE_TRANSFER_PROTOCOL message is needed, so the framing is done
+here and the script has no dependencies.
+
+Example (SITL):
+    make px4_sitl none
+    ./Tools/mavlink_ftp_throughput.py -f log/<date>/<log>.ulg -n 3
+"""
+
+from argparse import ArgumentParser
+import socket
+import struct
+import sys
+import time
+
+MSG_ID_FILE_TRANSFER_PROTOCOL = 110
+CRC_EXTRA_FILE_TRANSFER_PROTOCOL = 84
+
+CMD_TERMINATE_SESSION = 1
+CMD_OPEN_FILE_RO = 4
+CMD_BURST_READ_FILE = 15
+RSP_ACK = 128
+RSP_NAK = 129
+ERR_EOF = 6
+
+PAYLOAD_LENGTH = 251
+MAX_DATA_LENGTH = 239
+HEADER = struct.Struct('<HBBBBBBI')
+
+
+def x25crc(data, crc=0xffff):
+    for b in data:
+        tmp = b ^ (crc & 0xff)
+        tmp = (tmp ^ (tmp << 4)) & 0xff
+        crc = ((crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4)) & 0xffff
+    return crc
+
+
+class FtpClient:
+    def __init__(self, host, port, target_system, target_component):
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4 << 20)
+        self.sock.bind(('', 0))
+        self.addr = (host, port)
+        self.target_system = target_system
+        self.target_component = target_component
+        self.tx_seq = 0
+        self.req_seq = 0
+
+    def send(self, opcode, session=0, offset=0, size=0, data=b''):
+        self.req_seq = (self.req_seq + 1) & 0xffff
+        ftp = HEADER.pack(self.req_seq, session, opcode, size, 0, 0, 0, offset) + data
+        payload = bytes([0, self.target_system, self.target_component]) + ftp
+        payload = payload.rstrip(b'\0') or b'\0'
+        header = struct.pack('<BBBBBBBHB', 0xfd, len(payload), 0, 0, self.tx_seq, 255, 190,
+                             MSG_ID_FILE_TRANSFER_PROTOCOL & 0xffff, MSG_ID_FILE_TRANSFER_PROTOCOL >> 16)
+        crc = x25crc(header[1:] + payload)
+        crc = x25crc([CRC_EXTRA_FILE_TRANSFER_PROTOCOL], crc)
+        self.tx_seq = (self.tx_seq + 1) & 0xff
+        self.sock.sendto(header + payload + struct.pack('<H', crc), self.addr)
+
+    def receive(self, timeout):
+        """return the FTP payloads of the messages in one datagram"""
+        self.sock.settimeout(timeout)
+
+        try:
+            buf = self.sock.recv(65536)
+        except socket.timeout:
+            return []
+
+        payloads = []
+        i = 0
+
+        while i + 12 <= len(buf):
+            if buf[i] != 0xfd:
+                i += 1
+                continue
+
+            length = buf[i + 1]
+            msgid = buf[i + 7] | (buf[i + 8] << 8) | (buf[i + 9] << 16)
+
+            if msgid == MSG_ID_FILE_TRANSFER_PROTOCOL:
+                # skip target_network/system/component and restore the truncated zeros
+                payload = buf[i + 13:i + 10 + length]
+                payload += bytes(PAYLOAD_LENGTH - len(payload))
+
+                payloads.append(payload)
+
+            i += 12 + length
+
+        return payloads
+
+
+class Session:
+    def __init__(self, path):
+        self.path = path
+        self.id = None
+        self.size = 0
+        self.data = bytearray()
+        self.received = 0
+        self.chunks = {}
+        self.bursting = False
+        self.done = False
+        self.duplicates = 0
+        self.rerequests = 0
+        self.start = 0.
+        self.end = 0.
+
+    def add(self, offset, data):
+        if offset in self.chunks or offset < self.received:
+            self.duplicates += 1
+            return
+
+        self.data[offset:offset + len(data)] = data
+        self.chunks[offset] = len(data)
+
+        while self.received in self.chunks:
+            self.received += self.chunks.pop(self.received)
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('-u', '--udp', default='127.0.0.1:18570', help='host:port of the MAVLink instance')
+    parser.add_argument('-f', '--file', required=True, help='file to download (path on the vehicle)')
+    parser.add_argument('-n', '--sessions', type=int, default=1, help='number of parallel downloads of the file')
+    parser.add_argument('--target-system', type=int, default=1)
+    parser.add_argument('--target-component', type=int, default=1)
+    parser.add_argument('--verify', help='local copy of the file to compare the download against')
+    args = parser.parse_args()
+
+    host, port = args.udp.split(':')
+    client = FtpClient(host, int(port), args.target_system, args.target_component)
+    sessions = [Session(args.file) for _ in range(args.sessions)]
+
+    # open the sessions one by one, the reply carries the session id and the file size
+    for session in sessions:
+        for _ in range(10):
+            client.send(CMD_OPEN_FILE_RO, data=session.path.encode(), size=len(session.path))
+            deadline = time.monotonic() + 0.5
+
+            while session.id is None and time.monotonic() < deadline:
+                for payload in client.receive(0.1):
+                    _, sid, opcode, size, req_opcode, _, _, _ = HEADER.unpack_from(payload)
+
+                    if req_opcode == CMD_OPEN_FILE_RO and opcode == RSP_ACK:
+                        session.id = sid
+                        session.size = struct.unpack_from('<I', payload, HEADER.size)[0]
+                        session.data = bytearray(session.size)
+
+                    elif req_opcode == CMD_OPEN_FILE_RO and opcode == RSP_NAK:
+                        print('open failed, error {}'.format(payload[HEADER.size]))
+                        sys.exit(1)
+
+            if session.id is not None:
+                break
+
+        if session.id is None:
+            print('no reply to open, is the instance running at {}?'.format(args.udp))
+            sys.exit(1)
+
+    by_id = {session.id: session for session in sessions}
+    start = time.monotonic()
+
+    for session in sessions:
+        session.start = start
+        session.bursting = True
+        client.send(CMD_BURST_READ_FILE, session.id, 0, MAX_DATA_LENGTH)
+
+    last_rx = time.monotonic()
+
+    while not all(session.done for session in sessions):
+        payloads = client.receive(0.1)
+        now = time.monotonic()
+
+        for payload in payloads:
+            _, sid, opcode, size, req_opcode, burst_complete, _, offset = HEADER.unpack_from(payload)
+            session = by_id.get(sid)
+
+            if session is None or session.done or req_opcode != CMD_BURST_READ_FILE:
+                continue
+
+            last_rx = now
+
+            if opcode == RSP_ACK:
+                session.add(offset, payload[HEADER.size:HEADER.size + size])
+
+                if burst_complete:
+                    session.bursting = False
+
+            elif opcode == RSP_NAK:
+                session.bursting = False
+
+                if payload[HEADER.size] != ERR_EOF:
+                    print('session {}: burst failed, error {}'.format(sid, payload[HEADER.size]))
+                    sys.exit(1)
+
+            if session.received >= session.size and not session.done:
+                session.done = True
+                session.end = now
+
+        stalled = now - last_rx > 0.2
+
+        for session in sessions:
+            if not session.done and (not session.bursting or stalled):
+                # continue from the first missing offset
+                if stalled:
+                    session.rerequests += 1
+
+                session.bursting = True
+                client.send(CMD_BURST_READ_FILE, session.id, session.received, MAX_DATA_LENGTH)
+
+        if stalled:
+            last_rx = now
+
+    end = max(session.end for session in sessions)
+
+    for session in sessions:
+        client.send(CMD_TERMINATE_SESSION, session.id)
+
+    total = sum(session.size for session in sessions)
+
+    for session in sessions:
+        duration = session.end - session.start
+        print('session {}: {} bytes in {:.3f} s, {:.2f} MB/s ({} duplicates, {} stalls)'.format(
+            session.id, session.size, duration, session.size / duration / 1e6, session.duplicates, session.rerequests))
+
+    print('total: {} bytes in {:.3f} s, {:.2f} MB/s'.format(total, end - start, total / (end - start) / 1e6))
+
+    if args.verify:
+        with open(args.verify, 'rb') as f:
+            expected = f.read()
+
+        for session in sessions:
+            if session.data != expected:
+                print('session {}: downloaded data does not match {}'.format(session.id, args.verify))
+                sys.exit(1)
+
+        print('verify: ok')
+
+
+if __name__ == '__main__':
+    main()
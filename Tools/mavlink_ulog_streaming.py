@@ -28,12 +28,50 @@ except ImportError as e:
 class LoggingCompleted(Exception):
     pass
 
+
+# MAV_CMD_LOGGING_START param1 formats (ulog_stream.msg)
+LOG_FORMAT_ULOG = 0
+LOG_FORMAT_ULOG_COMPRESSED = 1
+
+
+def heatshrink_decode(data, window_bits, lookahead_bits):
+    ''' decode a complete heatshrink stream. Trailing padding bits never form a
+    complete literal or back-reference, so they are dropped. '''
+    out = bytearray()
+    num_bits = len(data) * 8
+    bit_pos = 0
+
+    def get_bits(count):
+        nonlocal bit_pos
+        value = 0
+        for _ in range(count):
+            byte = data[bit_pos >> 3]
+            value = (value << 1) | ((byte >> (7 - (bit_pos & 7))) & 1)
+            bit_pos += 1
+        return value
+
+    while bit_pos < num_bits:
+        if get_bits(1): # literal
+            if bit_pos + 8 > num_bits:
+                break
+            out.append(get_bits(8))
+        else: # back-reference
+            if bit_pos + window_bits + lookahead_bits > num_bits:
+                break
+            offset = get_bits(window_bits) + 1
+            count = get_bits(lookahead_bits) + 1
+            for _ in range(count):
+                # the window is zero-initialized
+                out.append(out[-offset] if offset <= len(out) else 0)
+    return out
+
 class MavlinkLogStreaming():
     '''Streams log data via MAVLink.
        Assumptions:
        - the sender only sends one acked message at a time
        - the data is in the ULog format '''
-    def __init__(self, portname, baudrate, output_filename, debug=0):
+    def __init__(self, portname, baudrate, output_filename, compressed=False,
+            target_rate=0, debug=0):
         self.baudrate = 0
         self._debug = debug
         self.buf = ''
@@ -53,6 +91,10 @@ class MavlinkLogStreaming():
         self.num_dropouts = 0
         self.target_component = 1
         self.got_sig_int = False
+        self.compressed = compressed
+        self.target_rate = target_rate
+        self.compressed_block = None # compressed data of the current block
+        self.decompressed_data = 0 # decompressed bytes since the last status output
 
     def debug(self, s, level=1):
         '''write some debug text'''
@@ -60,10 +102,11 @@ class MavlinkLogStreaming():
             print(s)
 
     def start_log(self):
+        log_format = LOG_FORMAT_ULOG_COMPRESSED if self.compressed else LOG_FORMAT_ULOG
         self.mav.mav.command_long_send(self.mav.target_system,
                 self.target_component,
                 mavutil.mavlink.MAV_CMD_LOGGING_START, 0,
-                0, 0, 0, 0, 0, 0, 0)
+                log_format, self.target_rate, 0, 0, 0, 0, 0)
 
     def stop_log(self):
         self.mav.mav.command_long_send(self.mav.target_system,
@@ -98,9 +141,12 @@ class MavlinkLogStreaming():
                         mavutil.mavlink.MAV_AUTOPILOT_GENERIC, 0, 0, 0)
                 next_heartbeat_time = heartbeat_time + 1
 
-            m, first_msg_start, num_drops = self.read_message()
+            m, first_msg_start, num_drops, compressed = self.read_message()
             if m is not None:
-                self.process_streamed_ulog_data(m, first_msg_start, num_drops)
+                if compressed:
+                    self.process_compressed_data(m, first_msg_start, num_drops)
+                else:
+                    self.process_streamed_ulog_data(m, first_msg_start, num_drops)
 
                 # status output
                 if self.logging_started:
@@ -108,11 +154,17 @@ class MavlinkLogStreaming():
                     measure_time_cur = timer()
                     dt = measure_time_cur - measure_time_start
                     if dt > 1:
-                        sys.stdout.write('\rData Rate: {:0.1f} KB/s  Drops: {:} \033[K'.format(
+                        sys.stdout.write('\rData Rate: {:0.1f} KB/s  Drops: {:} '.format(
                             measured_data / dt / 1024, self.num_dropouts))
+                        if self.compressed and measured_data > 0:
+                            sys.stdout.write('Decompressed: {:0.1f} KB/s ({:0.1f}x) '.format(
+                                self.decompressed_data / dt / 1024,
+                                self.decompressed_data / measured_data))
+                        sys.stdout.write('\033[K')
                         sys.stdout.flush()
                         measure_time_start = measure_time_cur
                         measured_data = 0
+                        self.decompressed_data = 0
 
             if not self.logging_started and timer()-self.start_time > 4:
                 raise Exception('Start timed out. Is the logger running in MAVLink mode?')
@@ -120,7 +172,7 @@ class MavlinkLogStreaming():
 
     def read_message(self):
         ''' read a single mavlink message, handle ACK & return a tuple of (data, first
-        message start, num dropouts) '''
+        message start, num dropouts, compressed) '''
         m = self.mav.recv_match(type=['LOGGING_DATA_ACKED',
                             'LOGGING_DATA', 'COMMAND_ACK'], blocking=True,
                             timeout=0.05)
@@ -133,12 +185,18 @@ class MavlinkLogStreaming():
                     if m.result == 0:
                         self.logging_started = True
                         print('Logging started. Waiting for Header...')
+                    elif self.compressed and m.result == mavutil.mavlink.MAV_RESULT_UNSUPPORTED:
+                        print('Compressed streaming not supported, falling back to uncompressed')
+                        self.compressed = False
+                        self.start_time = timer()
+                        self.start_log()
                     else:
                         raise Exception('Logging start failed', m.result)
                 elif m.command == mavutil.mavlink.MAV_CMD_LOGGING_STOP and \
                         m.result == mavutil.mavlink.MAV_RESULT_ACCEPTED:
+                    self.finish_compressed_block()
                     raise LoggingCompleted()
-                return None, 0, 0
+                return None, 0, 0, False
 
             # m is either 'LOGGING_DATA_ACKED' or 'LOGGING_DATA':
             is_newer, num_drops = self.check_sequence(m.sequence)
@@ -160,12 +218,14 @@ class MavlinkLogStreaming():
                         self.logging_started = True
                         self.got_header_section = True
                 self.last_sequence = m.sequence
-                return m.data[:m.length], m.first_message_offset, num_drops
+                # acked messages are always plain ULog
+                compressed = self.compressed and m.get_type() == 'LOGGING_DATA'
+                return m.data[:m.length], m.first_message_offset, num_drops, compressed
 
             else:
                 self.debug('dup/reordered message '+str(m.sequence))
 
-        return None, 0, 0
+        return None, 0, 0, False
 
 
     def check_sequence(self, seq):
@@ -221,6 +281,41 @@ class MavlinkLogStreaming():
         self.ulog_message = data # store the rest for the next message
 
 
+    def process_compressed_data(self, data, block_start, num_drops):
+        ''' collect compressed blocks and write them out once complete. Blocks
+        start at a ULog message boundary, so they can be decoded independently. '''
+        if num_drops > 0:
+            self.compressed_block = None # rest of the current block is lost
+            if self.got_header_section:
+                if num_drops > 25: num_drops = 25
+                self.file.write(bytearray([ 2, 0, 79, num_drops*10, 0 ]))
+
+        if block_start == 255:
+            if self.compressed_block is not None:
+                self.compressed_block.extend(data)
+            return
+
+        if self.compressed_block is not None:
+            self.compressed_block.extend(data[:block_start])
+            self.finish_compressed_block()
+        self.compressed_block = bytearray(data[block_start:])
+
+    def finish_compressed_block(self):
+        ''' decode the current compressed block and write it to the file '''
+        block = self.compressed_block
+        self.compressed_block = None
+        if not block:
+            return
+        # first byte: encoder window and lookahead size (in bits)
+        window_bits = block[0] >> 4
+        lookahead_bits = block[0] & 0xf
+        decoded = heatshrink_decode(block[1:], window_bits, lookahead_bits)
+        self.debug('block: {:} -> {:} bytes'.format(len(block), len(decoded)), 2)
+        self.decompressed_data += len(decoded)
+        remaining = self.write_ulog_messages(decoded)
+        if len(remaining) > 0:
+            self.debug('incomplete ULog message at block end')
+
     def write_ulog_messages(self, data):
         ''' write ulog data w/o integrity checking, assuming data starts with a
         valid ulog message. returns the remaining data at the end. '''
@@ -243,6 +338,11 @@ def main():
                       help="Mavlink port baud rate (default=115200)", default=115200)
     parser.add_argument("--output", "-o", dest="output", default = '.',
                       help="output file or directory (default=CWD)")
+    parser.add_argument("--compressed", "-c", dest="compressed", action='store_true',
+                      help="request compressed streaming, falls back to uncompressed if not supported")
+    parser.add_argument("--rate", "-r", dest="rate", type=int, default=0,
+                      help="target data rate in B/s the vehicle shapes the logged topics to "
+                      "(compressed streaming only, default=chosen by the vehicle from the link rate)")
     args = parser.parse_args()
 
     if os.path.isdir(args.output):
@@ -269,7 +369,8 @@ def main():
 
 
     print("Connecting to MAVLINK...")
-    mav_log_streaming = MavlinkLogStreaming(args.port, args.baudrate, filename)
+    mav_log_streaming = MavlinkLogStreaming(args.port, args.baudrate, filename,
+            args.compressed, args.rate)
 
     try:
         print('Starting log...')
@@ -37,13 +37,21 @@
 #
 #	Adds a googletest unit test to the test_results target.
 #
+#	Usage:
+#		px4_add_unit_gtest(SRC <file> [SHARDS <count>] ...)
+#
+#	Input:
+#		SHARDS		: optional, split the test cases of the binary into <count>
+#				  ctest entries using googletest sharding so that they can be
+#				  scheduled in parallel with `ctest -j`
+#
 function(px4_add_unit_gtest)
 	# skip if unit testing is not configured
 	if(BUILD_TESTING)
 		# parse source file and library dependencies from arguments
 		px4_parse_function_args(
 			NAME px4_add_unit_gtest
-			ONE_VALUE SRC
+			ONE_VALUE SRC SHARDS
 			MULTI_VALUE EXTRA_SRCS COMPILE_FLAGS INCLUDES LINKLIBS
 			REQUIRED SRC
 			ARGN ${ARGN})
@@ -69,9 +77,22 @@ function(px4_add_unit_gtest)
 		link_fuzztest(${TESTNAME})
 
 		# add the test to the ctest plan
-		add_test(NAME ${TESTNAME}
-		         COMMAND ${TESTNAME}
-		         WORKING_DIRECTORY ${PX4_BINARY_DIR})
+		if(SHARDS AND (SHARDS GREATER 1))
+			math(EXPR LAST_SHARD "${SHARDS} - 1")
+
+			foreach(SHARD RANGE ${LAST_SHARD})
+				add_test(NAME ${TESTNAME}-shard${SHARD}
+				         COMMAND ${TESTNAME}
+				         WORKING_DIRECTORY ${PX4_BINARY_DIR})
+				set_tests_properties(${TESTNAME}-shard${SHARD} PROPERTIES
+				                     ENVIRONMENT "GTEST_TOTAL_SHARDS=${SHARDS};GTEST_SHARD_INDEX=${SHARD}")
+			endforeach()
+
+		else()
+			add_test(NAME ${TESTNAME}
+			         COMMAND ${TESTNAME}
+			         WORKING_DIRECTORY ${PX4_BINARY_DIR})
+		endif()
 
 		# attach it to the unit test target
 		add_dependencies(test_results ${TESTNAME})
@@ -40,9 +40,28 @@
 #pragma once
 
 #include <containers/List.hpp>
+#include <uORB/topics/parameter_update.h>
 
 #include "param.h"
 
+/**
+ * @return true if param is in the changed set of a parameter change notification
+ */
+static inline bool param_in_update(const parameter_update_s &update, param_t param)
+{
+	if (update.changed_params_count > parameter_update_s::CHANGED_PARAMS_MAX) {
+		return true;
+	}
+
+	for (int i = 0; i < update.changed_params_count; i++) {
+		if (update.changed_params[i] == param) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 class ModuleParams : public ListNode<ModuleParams *>
 {
 public:
@@ -90,13 +109,46 @@ protected:
 		updateParamsImpl();
 	}
 
+	/**
+	 * @brief Check a parameter change notification against the parameters of this module and all children.
+	 *        Use it to skip updateParams() (and recalculations depending on it) when another module's
+	 *        parameter changed:
+	 *          if (paramsChanged(param_update)) { updateParams(); }
+	 * @return true if any of the parameters changed, or if the notification does not tell (e.g. too many changes,
+	 *         or notifications were missed in between)
+	 */
+	bool paramsChanged(const parameter_update_s &update)
+	{
+		// the changed set covers everything since the generation known to this module
+		bool changed = (update.generation == 0) || (update.previous_generation > _params_generation)
+			       || (update.changed_params_count > parameter_update_s::CHANGED_PARAMS_MAX);
+
+		if (update.generation > _params_generation) {
+			_params_generation = update.generation;
+		}
+
+		for (const auto &child : _children) {
+			changed = child->paramsChanged(update) || changed;
+		}
+
+		return changed || paramsChangedImpl(update);
+	}
+
 	/**
 	 * @brief The implementation for this is generated with the macro DEFINE_PARAMETERS()
 	 */
 	virtual void updateParamsImpl() {}
 
+	/**
+	 * @brief The implementation for this is generated with the macro DEFINE_PARAMETERS()
+	 */
+	virtual bool paramsChangedImpl(const parameter_update_s &) const { return false; }
+
 private:
 	/** @list _children The module parameter list of inheriting classes. */
 	List<ModuleParams *> _children;
 	ModuleParams *_parent{nullptr};
+
+	/** parameter values of this module are current up to this change generation (see paramsChanged()) */
+	uint32_t _params_generation{param_generation()};
 };
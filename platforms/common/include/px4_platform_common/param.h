@@ -62,6 +62,9 @@ inline static param_t param_handle(px4::params p)
 #define _CALL_UPDATE(x) \
 	STRIP(x).update();
 
+#define _CALL_IN_UPDATE(x) \
+	|| param_in_update(update, STRIP(x).handle())
+
 // define the parameter update method, which will update all parameters.
 // It is marked as 'final', so that wrong usages lead to a compile error (see below)
 #define _DEFINE_PARAMETER_UPDATE_METHOD(...) \
@@ -69,6 +72,9 @@ inline static param_t param_handle(px4::params p)
 	void updateParamsImpl() final { \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
+	bool paramsChangedImpl(const parameter_update_s &update) const final { \
+		return false APPLY_ALL(_CALL_IN_UPDATE, __VA_ARGS__); \
+	} \
 	private:
 
 // Define a list of parameters. This macro also creates code to update parameters.
@@ -88,6 +94,9 @@ inline static param_t param_handle(px4::params p)
 		parent_class::updateParamsImpl(); \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
+	bool paramsChangedImpl(const parameter_update_s &update) const override { \
+		return parent_class::paramsChangedImpl(update) APPLY_ALL(_CALL_IN_UPDATE, __VA_ARGS__); \
+	} \
 	private:
 
 #define DEFINE_PARAMETERS_CUSTOM_PARENT(parent_class, ...) \
@@ -102,6 +111,35 @@ inline static param_t param_handle(px4::params p)
 namespace do_not_explicitly_use_this_namespace
 {
 
+/**
+ * Change generation of a cached parameter value, so that update() only reads parameters that changed
+ * since. Empty (and always reporting a change) on constrained memory targets, to save the RAM per parameter.
+ */
+class ParamGeneration
+{
+protected:
+#if defined(CONSTRAINED_MEMORY)
+	bool changed(param_t, uint32_t &) const { return true; }
+	void updated(uint32_t) {}
+	void invalidate() {}
+#else
+	/// @param generation set to the current change generation, pass it to updated() after reading the value
+	bool changed(param_t handle, uint32_t &generation) const
+	{
+		generation = param_get_generation(handle);
+		return generation != _generation;
+	}
+
+	void updated(uint32_t generation) { _generation = generation; }
+
+	/// force the next update to read the value, e.g. after the cached value was modified locally
+	void invalidate() { _generation = UINT32_MAX; }
+
+private:
+	uint32_t _generation{UINT32_MAX};
+#endif // CONSTRAINED_MEMORY
+};
+
 template<typename T, px4::params p>
 class Param
 {
@@ -110,7 +148,7 @@ class Param
 // We use partial template specialization for each param type. This is only supported for classes, not individual methods,
 // which is why we have to repeat the whole class
 template<px4::params p>
-class Param<float, p>
+class Param<float, p> : private ParamGeneration
 {
 public:
 	// static type-check
@@ -144,7 +182,11 @@ public:
 		return false;
 	}
 
-	void set(float val) { _val = val; }
+	void set(float val)
+	{
+		_val = val;
+		invalidate();
+	}
 
 	void reset()
 	{
@@ -152,7 +194,21 @@ public:
 		update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	bool update()
+	{
+		uint32_t generation;
+
+		if (!changed(handle(), generation)) {
+			return true;
+		}
+
+		if (param_get(handle(), &_val) == 0) {
+			updated(generation);
+			return true;
+		}
+
+		return false;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
@@ -212,7 +268,7 @@ private:
 };
 
 template<px4::params p>
-class Param<int32_t, p>
+class Param<int32_t, p> : private ParamGeneration
 {
 public:
 	// static type-check
@@ -246,7 +302,11 @@ public:
 		return false;
 	}
 
-	void set(int32_t val) { _val = val; }
+	void set(int32_t val)
+	{
+		_val = val;
+		invalidate();
+	}
 
 	void reset()
 	{
@@ -254,7 +314,21 @@ public:
 		update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	bool update()
+	{
+		uint32_t generation;
+
+		if (!changed(handle(), generation)) {
+			return true;
+		}
+
+		if (param_get(handle(), &_val) == 0) {
+			updated(generation);
+			return true;
+		}
+
+		return false;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
@@ -314,7 +388,7 @@ private:
 };
 
 template<px4::params p>
-class Param<bool, p>
+class Param<bool, p> : private ParamGeneration
 {
 public:
 	// static type-check
@@ -356,7 +430,11 @@ public:
 		return false;
 	}
 
-	void set(bool val) { _val = val; }
+	void set(bool val)
+	{
+		_val = val;
+		invalidate();
+	}
 
 	void reset()
 	{
@@ -366,11 +444,18 @@ public:
 
 	bool update()
 	{
+		uint32_t generation;
+
+		if (!changed(handle(), generation)) {
+			return true;
+		}
+
 		int32_t value_int;
 		int ret = param_get(handle(), &value_int);
 
 		if (ret == 0) {
 			_val = value_int != 0;
+			updated(generation);
 			return true;
 		}
 
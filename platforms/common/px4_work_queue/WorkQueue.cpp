@@ -139,9 +139,17 @@ void WorkQueue::Add(WorkItem *item)
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
 	_q.push(item);
+
+	// If the worker thread is currently draining the queue it will pick up the new item
+	// before waiting again, e.g. when a WorkItem publishes data to another WorkItem on the same queue.
+	// Skip the semaphore post and the spurious wakeup that would follow.
+	const bool signal = !_processing;
+
 	work_unlock();
 
-	SignalWorkerThread();
+	if (signal) {
+		SignalWorkerThread();
+	}
 }
 
 void WorkQueue::SignalWorkerThread()
@@ -179,6 +187,8 @@ void WorkQueue::Run()
 
 		work_lock();
 
+		_processing = true;
+
 		// process queued work
 		while (!_q.empty()) {
 			WorkItem *work = _q.pop();
@@ -190,6 +200,8 @@ void WorkQueue::Run()
 			work_lock(); // re-lock
 		}
 
+		_processing = false;
+
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 
 		if (_q.empty()) {
@@ -0,0 +1,86 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "wqueue_chain_test.h"
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/time.h>
+
+#include <inttypes.h>
+
+AppState WQueueChainTest::appState;
+
+WQueueChainTest::WQueueChainTest()
+{
+	for (int i = 0; i < CHAIN_LENGTH; i++) {
+		_stages[i].test = this;
+		_stages[i].next = (i + 1 < CHAIN_LENGTH) ? &_stages[i + 1] : nullptr;
+	}
+}
+
+void WQueueChainTest::Stage::Run()
+{
+	if (next != nullptr) {
+		next->ScheduleNow();
+		return;
+	}
+
+	// end of the chain
+	const uint32_t latency_us = hrt_elapsed_time(&test->_trigger_time);
+	test->_latency_min_us = math::min(test->_latency_min_us, latency_us);
+	test->_latency_max_us = math::max(test->_latency_max_us, latency_us);
+	test->_latency_sum_us += latency_us;
+	test->_done.store(true);
+}
+
+int WQueueChainTest::main()
+{
+	appState.setRunning(true);
+
+	for (int i = 0; (i < ITERATIONS) && !appState.exitRequested(); i++) {
+		_done.store(false);
+		_trigger_time = hrt_absolute_time();
+		_stages[0].ScheduleNow();
+
+		// wait for the chain to finish, the latency is measured by the last item
+		while (!_done.load()) {
+			px4_usleep(1000);
+		}
+	}
+
+	PX4_INFO("WQueueChainTest finished: chain of %d items, latency min %" PRIu32 " us, mean %.1f us, max %" PRIu32 " us",
+		 CHAIN_LENGTH, _latency_min_us, (double)_latency_sum_us / ITERATIONS, _latency_max_us);
+
+	return 0;
+}
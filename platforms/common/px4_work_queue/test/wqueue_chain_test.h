@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <px4_platform_common/app.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <drivers/drv_hrt.h>
+
+using namespace px4;
+
+/**
+ * Latency probe for a chain of WorkItems on one work queue, each scheduling the next one from its Run(),
+ * like gyro -> rate controller -> control allocator -> output driver on wq:rate_ctrl.
+ * The first item is scheduled from another thread, like a sensor publication.
+ */
+class WQueueChainTest
+{
+public:
+	WQueueChainTest();
+	~WQueueChainTest() = default;
+
+	int main();
+
+	static px4::AppState appState; /* track requests to terminate app */
+
+private:
+	static constexpr int CHAIN_LENGTH = 4;
+	static constexpr int ITERATIONS = 1000;
+
+	class Stage : public px4::WorkItem
+	{
+	public:
+		Stage() : px4::WorkItem("WQueueChainTest", px4::wq_configurations::test1) {}
+
+		void Run() override;
+
+		WQueueChainTest *test{nullptr};
+		Stage *next{nullptr};
+	};
+
+	Stage _stages[CHAIN_LENGTH];
+
+	hrt_abstime _trigger_time{0};
+	px4::atomic_bool _done{false};
+
+	uint32_t _latency_min_us{UINT32_MAX};
+	uint32_t _latency_max_us{0};
+	uint64_t _latency_sum_us{0};
+};
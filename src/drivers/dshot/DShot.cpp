@@ -426,6 +426,7 @@ bool DShot::updateOutputs(uint16_t outputs[MAX_ACTUATORS],
 	}
 
 	up_dshot_trigger();
+	_mixing_output.outputLatched();
 
 	return true;
 }
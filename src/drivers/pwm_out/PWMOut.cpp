@@ -147,6 +147,10 @@ bool PWMOut::updateOutputs(uint16_t outputs[MAX_ACTUATORS],
 	 */
 	if (num_control_groups_updated > 0) {
 		up_pwm_update(_pwm_mask);
+
+		if (_pwm_initialized) {
+			_mixing_output.outputLatched();
+		}
 	}
 
 	return true;
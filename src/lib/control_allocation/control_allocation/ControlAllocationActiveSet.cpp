@@ -0,0 +1,333 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSet.cpp
+ *
+ * Constrained weighted least-squares control allocation
+ */
+
+#include "ControlAllocationActiveSet.hpp"
+
+#include <mathlib/math/Limits.hpp>
+#include <px4_platform_common/defines.h>
+
+ControlAllocationActiveSet::ControlAllocationActiveSet() :
+	_axis_weights(DEFAULT_AXIS_WEIGHTS)
+{
+}
+
+void
+ControlAllocationActiveSet::setEffectivenessMatrix(
+	const matrix::Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> &effectiveness,
+	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
+	bool update_normalization_scale)
+{
+	ControlAllocationPseudoInverse::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point,
+			num_actuators, update_normalization_scale);
+
+	// the Hessian depends on the effectiveness and the normalization scale, both only change with the mix
+	if (_mix_update_needed) {
+		_hessian_update_needed = true;
+	}
+}
+
+void
+ControlAllocationActiveSet::setAxisWeights(const matrix::Vector<float, NUM_AXES> &axis_weights)
+{
+	_axis_weights = axis_weights;
+	_hessian_update_needed = true;
+}
+
+void
+ControlAllocationActiveSet::updateHessian()
+{
+	// effectiveness in the (normalized) units of the control setpoint, see getAllocatedControl()
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> effectiveness_scaled;
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		for (int i = 0; i < _num_actuators; i++) {
+			effectiveness_scaled(axis, i) = _control_allocation_scale(axis) * _effectiveness(axis, i);
+			_weighted_effectiveness(axis, i) = _axis_weights(axis) * _axis_weights(axis) * effectiveness_scaled(axis, i);
+		}
+	}
+
+	// H = Bn^T Wv^2 Bn + eps I
+	_hessian = _weighted_effectiveness.transposeMultiply(effectiveness_scaled);
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		_hessian(i, i) += EPSILON_REGULARIZATION;
+	}
+
+	_hessian_update_needed = false;
+}
+
+bool
+ControlAllocationActiveSet::solveFree(const ActuatorVector &rhs, ActuatorVector &p) const
+{
+	int free_index[NUM_ACTUATORS];
+	int num_free = 0;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_active_set[i] == Bound::FREE) {
+			free_index[num_free++] = i;
+		}
+	}
+
+	// Cholesky decomposition of the reduced Hessian, L is stored in the lower triangle
+	float L[NUM_ACTUATORS][NUM_ACTUATORS];
+
+	for (int r = 0; r < num_free; r++) {
+		for (int c = 0; c <= r; c++) {
+			float sum = _hessian(free_index[r], free_index[c]);
+
+			for (int k = 0; k < c; k++) {
+				sum -= L[r][k] * L[c][k];
+			}
+
+			if (r == c) {
+				if (sum <= FLT_EPSILON) {
+					return false;
+				}
+
+				L[r][r] = sqrtf(sum);
+
+			} else {
+				L[r][c] = sum / L[c][c];
+			}
+		}
+	}
+
+	// forward substitution L y = rhs
+	float y[NUM_ACTUATORS];
+
+	for (int r = 0; r < num_free; r++) {
+		float sum = rhs(free_index[r]);
+
+		for (int k = 0; k < r; k++) {
+			sum -= L[r][k] * y[k];
+		}
+
+		y[r] = sum / L[r][r];
+	}
+
+	// back substitution L^T x = y
+	p.setZero();
+
+	for (int r = num_free - 1; r >= 0; r--) {
+		float sum = y[r];
+
+		for (int k = r + 1; k < num_free; k++) {
+			sum -= L[k][r] * p(free_index[k]);
+		}
+
+		p(free_index[r]) = sum / L[r][r];
+	}
+
+	return true;
+}
+
+void
+ControlAllocationActiveSet::allocate()
+{
+	//Compute new gains if needed
+	updatePseudoInverse();
+
+	if (_hessian_update_needed) {
+		updateHessian();
+	}
+
+	_prev_actuator_sp = _actuator_sp;
+
+	// unconstrained solution, also used as regularization target
+	const matrix::Vector<float, NUM_AXES> control_delta = _control_sp - _control_trim;
+	const ActuatorVector actuator_pinv = _actuator_trim + _mix * control_delta;
+
+	// warm start: previous solution, with the previously active constraints at their bounds
+	ActuatorVector u = _actuator_sp;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_actuator_max(i) < _actuator_min(i)) {
+			// disabled actuator, hold at trim
+			u(i) = _actuator_trim(i);
+			_active_set[i] = Bound::LOWER;
+
+		} else if (_active_set[i] == Bound::LOWER) {
+			u(i) = _actuator_min(i);
+
+		} else if (_active_set[i] == Bound::UPPER) {
+			u(i) = _actuator_max(i);
+
+		} else {
+			// the setpoint can be NaN (e.g. motors stopped by the effectiveness during spool-up),
+			// which would poison the gradient: restart such actuators from the unconstrained solution
+			if (!PX4_ISFINITE(u(i))) {
+				u(i) = PX4_ISFINITE(actuator_pinv(i)) ? actuator_pinv(i) : _actuator_trim(i);
+			}
+
+			u(i) = math::constrain(u(i), _actuator_min(i), _actuator_max(i));
+		}
+	}
+
+	// true if u is the optimum on the current set of free actuators
+	bool stationary = false;
+	int iteration = 0;
+
+	for (; iteration < MAX_ITERATIONS; iteration++) {
+		// gradient g = Bn^T Wv^2 (Bn (u - u_trim) - c) + eps (u - u_pinv)
+		const matrix::Vector<float, NUM_AXES> control_error = _effectiveness * (u - _actuator_trim);
+		matrix::Vector<float, NUM_AXES> residual;
+
+		for (int axis = 0; axis < NUM_AXES; axis++) {
+			residual(axis) = _control_allocation_scale(axis) * control_error(axis) - control_delta(axis);
+		}
+
+		ActuatorVector gradient = _weighted_effectiveness.transposeMultiply(residual);
+		gradient += (u - actuator_pinv) * EPSILON_REGULARIZATION;
+
+		// optimal step on the free actuators: H_ff p_f = -g_f
+		ActuatorVector step;
+
+		if (!stationary) {
+			if (!solveFree(-gradient, step)) {
+				break;
+			}
+
+			float step_max = 0.f;
+
+			for (int i = 0; i < _num_actuators; i++) {
+				step_max = fmaxf(step_max, fabsf(step(i)));
+			}
+
+			stationary = (step_max < 1e-5f);
+		}
+
+		if (stationary) {
+			// stationary point, check Lagrange multipliers of the active constraints
+			int release = -1;
+			float lambda_min = -1e-6f;
+
+			for (int i = 0; i < _num_actuators; i++) {
+				if (_actuator_max(i) < _actuator_min(i)) {
+					continue;
+				}
+
+				const float lambda = (_active_set[i] == Bound::LOWER) ? gradient(i)
+						     : (_active_set[i] == Bound::UPPER) ? -gradient(i) : 0.f;
+
+				if (lambda < lambda_min) {
+					lambda_min = lambda;
+					release = i;
+				}
+			}
+
+			if (release < 0) {
+				// optimal
+				iteration++;
+				break;
+			}
+
+			_active_set[release] = Bound::FREE;
+			stationary = false;
+
+		} else {
+			// largest feasible step length along the step direction
+			float alpha = 1.f;
+			int blocking = -1;
+
+			for (int i = 0; i < _num_actuators; i++) {
+				if (_active_set[i] != Bound::FREE) {
+					continue;
+				}
+
+				if ((step(i) < 0.f) && (u(i) + step(i) < _actuator_min(i))) {
+					const float alpha_i = (_actuator_min(i) - u(i)) / step(i);
+
+					if (alpha_i < alpha) {
+						alpha = alpha_i;
+						blocking = i;
+					}
+
+				} else if ((step(i) > 0.f) && (u(i) + step(i) > _actuator_max(i))) {
+					const float alpha_i = (_actuator_max(i) - u(i)) / step(i);
+
+					if (alpha_i < alpha) {
+						alpha = alpha_i;
+						blocking = i;
+					}
+				}
+			}
+
+			u += step * alpha;
+
+			if (blocking < 0) {
+				// full step taken, optimal on the current free set
+				stationary = true;
+
+			} else {
+				// add blocking constraint to the active set
+				if (step(blocking) < 0.f) {
+					_active_set[blocking] = Bound::LOWER;
+					u(blocking) = _actuator_min(blocking);
+
+				} else {
+					_active_set[blocking] = Bound::UPPER;
+					u(blocking) = _actuator_max(blocking);
+				}
+			}
+		}
+	}
+
+	_last_iterations = iteration;
+
+	bool finite = true;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		finite = finite && PX4_ISFINITE(u(i));
+	}
+
+	if (!finite) {
+		// fall back to the clipped pseudo-inverse solution and restart the active set from scratch
+		u = actuator_pinv;
+		clipActuatorSetpoint(u);
+
+		for (int i = 0; i < _num_actuators; i++) {
+			_active_set[i] = Bound::FREE;
+		}
+	}
+
+	for (int i = 0; i < _num_actuators; i++) {
+		_actuator_sp(i) = u(i);
+	}
+}
@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSet.hpp
+ *
+ * Constrained weighted least-squares control allocation
+ *
+ * Solves
+ *   min |Wv (B (u - u_trim) - c)|^2 + eps |u - u_pinv|^2
+ *   s.t. u_min <= u <= u_max
+ * with an active-set method, where u_pinv is the unconstrained pseudo-inverse solution.
+ * If the pseudo-inverse solution is within the actuator limits it is returned unchanged,
+ * otherwise the control error is distributed according to the axis weights Wv instead
+ * of being clipped.
+ *
+ * The active set of the previous solution is used as starting point, so the solver
+ * usually converges within 1-2 iterations. The number of iterations is bounded.
+ */
+
+#pragma once
+
+#include "ControlAllocationPseudoInverse.hpp"
+
+class ControlAllocationActiveSet: public ControlAllocationPseudoInverse
+{
+public:
+	ControlAllocationActiveSet();
+	virtual ~ControlAllocationActiveSet() = default;
+
+	static constexpr int MAX_ITERATIONS = 10;
+
+	/**
+	 * Default weights of the control axes (roll, pitch, yaw, thrust x, y, z).
+	 *
+	 * Roll and pitch keep the vehicle upright, so under saturation they are kept at the expense of yaw,
+	 * and yaw at the expense of thrust. The axis errors enter the cost squared, so halving a weight makes
+	 * the axis four times cheaper to give up.
+	 */
+	static constexpr float DEFAULT_AXIS_WEIGHTS[NUM_AXES] {1.f, 1.f, 0.5f, 0.25f, 0.25f, 0.25f};
+
+	// regularization towards the pseudo-inverse solution, small compared to the axis weights
+	static constexpr float EPSILON_REGULARIZATION = 1e-3f;
+
+	void allocate() override;
+	void setEffectivenessMatrix(const matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> &effectiveness,
+				    const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
+				    bool update_normalization_scale) override;
+
+	/**
+	 * Set the weight of each control axis, higher weights are prioritized under saturation
+	 */
+	void setAxisWeights(const matrix::Vector<float, NUM_AXES> &axis_weights);
+
+	/**
+	 * Number of solver iterations used by the last allocation
+	 */
+	int getLastIterations() const { return _last_iterations; }
+
+private:
+	enum class Bound : int8_t {
+		FREE = 0,
+		LOWER = -1,
+		UPPER = 1,
+	};
+
+	void updateHessian();
+
+	/**
+	 * Solve H_ff * p_f = rhs_f on the free actuators using a Cholesky decomposition
+	 *
+	 * @return false if the reduced Hessian is not positive definite
+	 */
+	bool solveFree(const ActuatorVector &rhs, ActuatorVector &p) const;
+
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _hessian;	///< Bn^T Wv^2 Bn + eps I
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> _weighted_effectiveness; ///< Wv^2 Bn
+	matrix::Vector<float, NUM_AXES> _axis_weights;
+
+	Bound _active_set[NUM_ACTUATORS] {};
+
+	int _last_iterations{0};
+	bool _hessian_update_needed{true};
+};
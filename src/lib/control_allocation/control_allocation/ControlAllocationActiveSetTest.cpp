@@ -0,0 +1,249 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSetTest.cpp
+ *
+ * Tests for the constrained weighted least-squares control allocation
+ */
+
+#include <gtest/gtest.h>
+#include <ControlAllocationActiveSet.hpp>
+#include <mathlib/math/Limits.hpp>
+#include <px4_platform_common/defines.h>
+
+using namespace matrix;
+using ActuatorVector = ControlAllocation::ActuatorVector;
+
+class ControlAllocationActiveSetTestQuadX : public ::testing::Test
+{
+public:
+	static constexpr int NUM_ACTUATORS = 4;
+
+	void SetUp() override
+	{
+		// quadrotor x, clockwise motor numbering
+		const float roll[NUM_ACTUATORS] {-0.5f, -0.5f, 0.5f, 0.5f};
+		const float pitch[NUM_ACTUATORS] {0.5f, -0.5f, -0.5f, 0.5f};
+		const float yaw[NUM_ACTUATORS] {0.3f, -0.3f, 0.3f, -0.3f};
+
+		for (int i = 0; i < NUM_ACTUATORS; i++) {
+			_effectiveness(ControlAllocation::ROLL, i) = roll[i];
+			_effectiveness(ControlAllocation::PITCH, i) = pitch[i];
+			_effectiveness(ControlAllocation::YAW, i) = yaw[i];
+			_effectiveness(ControlAllocation::THRUST_Z, i) = -0.25f;
+		}
+
+		setup(_active_set);
+		setup(_pseudo_inverse);
+	}
+
+	void setup(ControlAllocation &allocation)
+	{
+		allocation.setEffectivenessMatrix(_effectiveness, ActuatorVector{}, ActuatorVector{}, NUM_ACTUATORS, false);
+		allocation.setActuatorMin(ActuatorVector{});
+		ActuatorVector actuator_max;
+		actuator_max.setAll(1.f);
+		allocation.setActuatorMax(actuator_max);
+	}
+
+	Vector<float, 6> controlSetpoint(float roll, float pitch, float yaw, float thrust)
+	{
+		Vector<float, 6> control_sp;
+		control_sp(ControlAllocation::ROLL) = roll;
+		control_sp(ControlAllocation::PITCH) = pitch;
+		control_sp(ControlAllocation::YAW) = yaw;
+		control_sp(ControlAllocation::THRUST_Z) = thrust;
+		return control_sp;
+	}
+
+	/**
+	 * Minimizer of the cost function of ControlAllocationActiveSet, found by projected gradient descent
+	 * iterated until it has converged (the normalization scale is 1 in these tests)
+	 */
+	ActuatorVector referenceSolution(const Vector<float, 6> &control_sp)
+	{
+		const float *axis_weights = ControlAllocationActiveSet::DEFAULT_AXIS_WEIGHTS;
+		const double epsilon = (double)ControlAllocationActiveSet::EPSILON_REGULARIZATION;
+
+		// regularization target: the unconstrained pseudo-inverse solution
+		ControlAllocationPseudoInverse pseudo_inverse;
+		setup(pseudo_inverse);
+		pseudo_inverse.setControlSetpoint(control_sp);
+		pseudo_inverse.allocate();
+		const ActuatorVector &actuator_pinv = pseudo_inverse.getActuatorSetpoint();
+
+		// step size below the inverse of the largest eigenvalue of the Hessian
+		double hessian_trace = epsilon * NUM_ACTUATORS;
+
+		for (int i = 0; i < NUM_ACTUATORS; i++) {
+			for (int axis = 0; axis < 6; axis++) {
+				hessian_trace += (double)(axis_weights[axis] * axis_weights[axis] * _effectiveness(axis, i) * _effectiveness(axis, i));
+			}
+		}
+
+		const double step = 1. / hessian_trace;
+		double u[NUM_ACTUATORS] {};
+
+		for (int iteration = 0; iteration < 200000; iteration++) {
+			double residual[6];
+
+			for (int axis = 0; axis < 6; axis++) {
+				residual[axis] = -(double)control_sp(axis);
+
+				for (int i = 0; i < NUM_ACTUATORS; i++) {
+					residual[axis] += (double)_effectiveness(axis, i) * u[i];
+				}
+			}
+
+			for (int i = 0; i < NUM_ACTUATORS; i++) {
+				double gradient = epsilon * (u[i] - (double)actuator_pinv(i));
+
+				for (int axis = 0; axis < 6; axis++) {
+					gradient += (double)(axis_weights[axis] * axis_weights[axis] * _effectiveness(axis, i)) * residual[axis];
+				}
+
+				u[i] = math::constrain(u[i] - step * gradient, 0., 1.);
+			}
+		}
+
+		ActuatorVector solution;
+
+		for (int i = 0; i < NUM_ACTUATORS; i++) {
+			solution(i) = (float)u[i];
+		}
+
+		return solution;
+	}
+
+	Matrix<float, 6, 16> _effectiveness;
+	ControlAllocationActiveSet _active_set;
+	ControlAllocationPseudoInverse _pseudo_inverse;
+};
+
+TEST_F(ControlAllocationActiveSetTestQuadX, UnsaturatedMatchesPseudoInverse)
+{
+	const Vector<float, 6> control_sp = controlSetpoint(0.05f, -0.03f, 0.02f, -0.5f);
+
+	_active_set.setControlSetpoint(control_sp);
+	_active_set.allocate();
+	_pseudo_inverse.setControlSetpoint(control_sp);
+	_pseudo_inverse.allocate();
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(_active_set.getActuatorSetpoint()(i), _pseudo_inverse.getActuatorSetpoint()(i), 1e-4f);
+	}
+
+	EXPECT_LE(_active_set.getLastIterations(), 2);
+}
+
+TEST_F(ControlAllocationActiveSetTestQuadX, SaturatedYawWithinLimits)
+{
+	// full thrust and yaw, the pseudo-inverse solution saturates
+	const Vector<float, 6> control_sp = controlSetpoint(0.f, 0.f, 0.3f, -0.95f);
+
+	_active_set.setControlSetpoint(control_sp);
+	_active_set.allocate();
+	_pseudo_inverse.setControlSetpoint(control_sp);
+	_pseudo_inverse.allocate();
+	_pseudo_inverse.clipActuatorSetpoint();
+
+	const ActuatorVector &actuator_sp = _active_set.getActuatorSetpoint();
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		EXPECT_GE(actuator_sp(i), 0.f);
+		EXPECT_LE(actuator_sp(i), 1.f);
+	}
+
+	// roll and pitch stay zero, yaw is better preserved than by clipping
+	const Vector<float, 6> allocated = _active_set.getAllocatedControl();
+	const Vector<float, 6> allocated_clipped = _pseudo_inverse.getAllocatedControl();
+	EXPECT_NEAR(allocated(ControlAllocation::ROLL), 0.f, 1e-4f);
+	EXPECT_NEAR(allocated(ControlAllocation::PITCH), 0.f, 1e-4f);
+	EXPECT_GT(allocated(ControlAllocation::YAW), allocated_clipped(ControlAllocation::YAW));
+
+	const ActuatorVector reference = referenceSolution(control_sp);
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(actuator_sp(i), reference(i), 1e-4f) << "actuator " << i;
+	}
+
+	// warm start from the previous active set
+	_active_set.allocate();
+	EXPECT_LE(_active_set.getLastIterations(), 2);
+}
+
+TEST_F(ControlAllocationActiveSetTestQuadX, InfeasibleMatchesReferenceSolution)
+{
+	// infeasible demand on all axes
+	const Vector<float, 6> control_sp = controlSetpoint(2.f, -2.f, 2.f, -2.f);
+
+	_active_set.setControlSetpoint(control_sp);
+	_active_set.allocate();
+
+	// a cold start moves one actuator to a bound per iteration, plus the final optimality check
+	EXPECT_LE(_active_set.getLastIterations(), NUM_ACTUATORS + 1);
+
+	const ActuatorVector reference = referenceSolution(control_sp);
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(_active_set.getActuatorSetpoint()(i), reference(i), 1e-4f) << "actuator " << i;
+	}
+}
+
+TEST_F(ControlAllocationActiveSetTestQuadX, NanWarmStart)
+{
+	// GIVEN: a previous solution
+	_active_set.setControlSetpoint(controlSetpoint(0.f, 0.f, 0.f, -0.5f));
+	_active_set.allocate();
+
+	// AND: actuators set to NaN afterwards (as done by some effectiveness sources for stopped motors)
+	ActuatorVector actuator_sp = _active_set.getActuatorSetpoint();
+	actuator_sp(0) = NAN;
+	actuator_sp(2) = NAN;
+	_active_set.setActuatorSetpoint(actuator_sp);
+
+	// WHEN: a different thrust is requested
+	const Vector<float, 6> control_sp = controlSetpoint(0.f, 0.f, 0.f, -0.8f);
+	_active_set.setControlSetpoint(control_sp);
+	_active_set.allocate();
+	_pseudo_inverse.setControlSetpoint(control_sp);
+	_pseudo_inverse.allocate();
+
+	// THEN: all actuators follow the new demand instead of keeping the previous solution
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		EXPECT_TRUE(PX4_ISFINITE(_active_set.getActuatorSetpoint()(i)));
+		EXPECT_NEAR(_active_set.getActuatorSetpoint()(i), _pseudo_inverse.getActuatorSetpoint()(i), 1e-4f);
+	}
+}
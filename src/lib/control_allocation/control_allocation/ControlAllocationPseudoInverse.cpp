@@ -47,10 +47,18 @@ ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 	bool update_normalization_scale)
 {
+	// Only recompute the pseudo-inverse if the matrix actually changed. Some matrices are re-assigned
+	// unchanged at control rate, e.g. the control surfaces of a tiltrotor while the rotors are tilting.
+	const bool effectiveness_changed = !matrix::isEqual(_effectiveness, effectiveness, 0.f)
+					   || (num_actuators != _num_actuators) || update_normalization_scale;
+
 	ControlAllocation::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, num_actuators,
 			update_normalization_scale);
-	_mix_update_needed = true;
-	_normalization_needs_update = update_normalization_scale;
+
+	if (effectiveness_changed) {
+		_mix_update_needed = true;
+		_normalization_needs_update = update_normalization_scale;
+	}
 
 	if (_metric_allocation && update_normalization_scale) {
 		// adding #include <px4_platform_common/log.h> + PX4_WARN leads to failed linking on test
@@ -73,6 +81,8 @@ ControlAllocationPseudoInverse::updatePseudoInverse()
 			normalizeControlAllocationMatrix();
 		}
 
+		updateMixSparsity();
+
 		_mix_update_needed = false;
 	}
 }
@@ -176,6 +186,24 @@ ControlAllocationPseudoInverse::normalizeControlAllocationMatrix()
 	}
 }
 
+void
+ControlAllocationPseudoInverse::updateMixSparsity()
+{
+	// Most airframes only use a subset of the axes (e.g. no lateral thrust on multicopters)
+	// and of the actuators, so only these are visited when allocating
+	_num_mix_axes = 0;
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		for (int i = 0; i < _num_actuators; i++) {
+			// NaN entries count as used, so that they still propagate to the actuator setpoint
+			if (_mix(i, axis) != 0.f) {
+				_mix_axes[_num_mix_axes++] = axis;
+				break;
+			}
+		}
+	}
+}
+
 void
 ControlAllocationPseudoInverse::allocate()
 {
@@ -184,6 +212,18 @@ ControlAllocationPseudoInverse::allocate()
 
 	_prev_actuator_sp = _actuator_sp;
 
-	// Allocate
-	_actuator_sp = _actuator_trim + _mix * (_control_sp - _control_trim);
+	// Allocate: actuator_sp = actuator_trim + mix * (control_sp - control_trim)
+	const matrix::Vector<float, NUM_AXES> control_delta = _control_sp - _control_trim;
+
+	_actuator_sp = _actuator_trim;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		float actuator_delta = 0.f;
+
+		for (int k = 0; k < _num_mix_axes; k++) {
+			actuator_delta += _mix(i, _mix_axes[k]) * control_delta(_mix_axes[k]);
+		}
+
+		_actuator_sp(i) += actuator_delta;
+	}
 }
@@ -62,6 +62,9 @@ public:
 protected:
 	matrix::Matrix<float, NUM_ACTUATORS, NUM_AXES> _mix;
 
+	uint8_t _mix_axes[NUM_AXES] {}; ///< control axes with non-zero mix column
+	int _num_mix_axes{0};
+
 	bool _mix_update_needed{false};
 	bool _metric_allocation{false};
 
@@ -73,6 +76,7 @@ protected:
 
 private:
 	void normalizeControlAllocationMatrix();
+	void updateMixSparsity();
 	void updateControlAllocationMatrixScale();
 	bool _normalization_needs_update{false};
 };
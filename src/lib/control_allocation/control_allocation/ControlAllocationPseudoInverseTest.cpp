@@ -91,3 +91,54 @@ TEST(ControlAllocationMetricTest, AllZeroCase)
 	EXPECT_EQ(actuator_sp, actuator_sp_expected);
 	EXPECT_EQ(control_allocated, control_allocated_expected);
 }
+
+class ControlAllocationPseudoInverseUpdate : public ControlAllocationPseudoInverse
+{
+public:
+	bool mixUpdateNeeded() const { return _mix_update_needed; }
+};
+
+TEST(ControlAllocationTest, SkipUnchangedEffectiveness)
+{
+	ControlAllocationPseudoInverseUpdate method;
+
+	matrix::Matrix<float, 6, 16> effectiveness;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+	effectiveness(0, 0) = 1.f;
+	effectiveness(5, 1) = -1.f;
+
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 2, true);
+	EXPECT_TRUE(method.mixUpdateNeeded());
+	method.allocate();
+	EXPECT_FALSE(method.mixUpdateNeeded());
+
+	// same matrix again, no recomputation needed
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 2, false);
+	EXPECT_FALSE(method.mixUpdateNeeded());
+
+	// changed matrix
+	effectiveness(0, 0) = 0.9f;
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 2, false);
+	EXPECT_TRUE(method.mixUpdateNeeded());
+}
+
+TEST(ControlAllocationTest, NanEffectivenessPropagates)
+{
+	ControlAllocationPseudoInverse method;
+
+	matrix::Matrix<float, 6, 16> effectiveness;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+	matrix::Vector<float, 6> control_sp;
+	effectiveness(0, 0) = NAN;
+	effectiveness(5, 1) = -1.f;
+	control_sp(0) = 0.1f;
+
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 2, false);
+	method.setControlSetpoint(control_sp);
+	method.allocate();
+
+	// an invalid mix must not be hidden behind a plausible looking setpoint
+	EXPECT_FALSE(PX4_ISFINITE(method.getActuatorSetpoint()(0)));
+}
@@ -35,6 +35,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/conversion/rotation.h>
+#include <lib/drivers/device/FIFOTimestampFilter.hpp>
 #include <lib/geo/geo.h>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_accel.h>
@@ -83,4 +84,6 @@ private:
 	uint32_t		_error_count{0};
 
 	int16_t			_last_sample[3] {};
+
+	FIFOTimestampFilter	_timestamp_filter{};
 };
@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file FIFOTimestampFilter.hpp
+ *
+ * Reconstructs evenly spaced IMU FIFO sample timestamps from jittery measurements
+ * (data ready interrupt or FIFO read time) with a second order phase-locked loop
+ * tracking the actual sensor output data rate and sample phase.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+
+class FIFOTimestampFilter
+{
+public:
+	FIFOTimestampFilter() = default;
+	~FIFOTimestampFilter() = default;
+
+	/**
+	 * Update with a new FIFO batch.
+	 *
+	 * @param timestamp_sample measured timestamp of the newest sample in the batch
+	 * @param samples number of samples in the batch
+	 * @param interval_us in: nominal sample interval configured in the sensor, out: estimated actual sample interval
+	 * @return reconstructed timestamp of the newest sample
+	 */
+	hrt_abstime update(const hrt_abstime timestamp_sample, const uint8_t samples, float &interval_us)
+	{
+		const float interval_nominal_us = interval_us;
+
+		if ((samples == 0) || !(interval_nominal_us > 0.f)) {
+			return timestamp_sample;
+		}
+
+		if ((_timestamp_last == 0) || (fabsf(interval_nominal_us - _interval_nominal_us) > 0.01f * interval_nominal_us)) {
+			// first batch or sensor reconfigured
+			reset(timestamp_sample, interval_nominal_us);
+			return timestamp_sample;
+		}
+
+		// phase error between the measured and the predicted timestamp of the newest sample
+		const float prediction_us = samples * _interval_us;
+		const float error_us = static_cast<float>(static_cast<int64_t>(timestamp_sample - _timestamp_last)) - _timestamp_fraction_us
+				       - prediction_us;
+
+		if (fabsf(error_us) > RESET_THRESHOLD * _interval_us) {
+			// the batch doesn't line up with the predicted samples (FIFO overflow, sensor reset or a measurement
+			// off by more than the sample spacing), so the phase can't be tracked across it: resynchronize
+			reset(timestamp_sample, interval_nominal_us);
+			return timestamp_sample;
+		}
+
+		// PI loop: proportional phase correction, integral correction of the sample interval (sensor clock drift)
+		_interval_us = math::constrain(_interval_us + FREQUENCY_GAIN * error_us / samples,
+					       (1.f - MAX_CLOCK_DRIFT) * _interval_nominal_us, (1.f + MAX_CLOCK_DRIFT) * _interval_nominal_us);
+
+		const float advance_us = _timestamp_fraction_us + prediction_us + PHASE_GAIN * error_us;
+		const uint32_t advance_whole_us = static_cast<uint32_t>(advance_us);
+
+		_timestamp_last += advance_whole_us;
+		_timestamp_fraction_us = advance_us - advance_whole_us;
+
+		// never report a sample from the future
+		const hrt_abstime now = hrt_absolute_time();
+
+		if (_timestamp_last > now) {
+			_timestamp_last = now;
+			_timestamp_fraction_us = 0.f;
+		}
+
+		interval_us = _interval_us;
+
+		return _timestamp_last;
+	}
+
+private:
+	void reset(const hrt_abstime timestamp_sample, const float interval_nominal_us)
+	{
+		_timestamp_last = timestamp_sample;
+		_timestamp_fraction_us = 0.f;
+		_interval_nominal_us = interval_nominal_us;
+		_interval_us = interval_nominal_us;
+	}
+
+	static constexpr float PHASE_GAIN = 0.05f;         ///< fraction of the phase error corrected per batch
+	static constexpr float FREQUENCY_GAIN = 0.001f;    ///< fraction of the phase error attributed to the sample interval
+	static constexpr float MAX_CLOCK_DRIFT = 0.05f;    ///< maximum deviation of the sensor clock from nominal
+	static constexpr float RESET_THRESHOLD = 0.5f;     ///< phase error (fraction of the sample interval) triggering a reset
+
+	hrt_abstime _timestamp_last{0};    ///< reconstructed timestamp of the newest sample
+	float _timestamp_fraction_us{0.f}; ///< sub-microsecond part of _timestamp_last
+
+	float _interval_nominal_us{NAN};
+	float _interval_us{NAN};
+};
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the FIFOTimestampFilter class
+ * Run this test only using make tests TESTFILTER=FIFOTimestampFilter
+ */
+
+#include <gtest/gtest.h>
+
+#include "FIFOTimestampFilter.hpp"
+
+// the filter never reports timestamps past the current time, the tests control it
+static hrt_abstime test_now = 0;
+
+hrt_abstime hrt_absolute_time()
+{
+	return test_now;
+}
+
+class FIFOTimestampFilterTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_timestamp_true = 1'000'000.;
+		_rand = 1;
+	}
+
+	/**
+	 * Simulate a sensor producing samples every interval_true_us, read in batches with a measured
+	 * timestamp disturbed by up to +-jitter_us.
+	 * @return reconstructed timestamp of the newest sample
+	 */
+	hrt_abstime readBatch(float &interval_us, uint8_t samples, double interval_true_us, float jitter_us = 0.f)
+	{
+		_timestamp_true += samples * interval_true_us;
+		const hrt_abstime measured = static_cast<hrt_abstime>(_timestamp_true + static_cast<double>(jitter_us * random()));
+		test_now = measured + 2000;
+		return _filter.update(measured, samples, interval_us);
+	}
+
+	/** samples produced by the sensor but never read (FIFO overflow) */
+	void dropSamples(unsigned samples, double interval_true_us) { _timestamp_true += samples * interval_true_us; }
+
+	double timestampTrue() const { return _timestamp_true; }
+
+	FIFOTimestampFilter _filter;
+
+private:
+	/** deterministic uniform random number in [-1, 1] */
+	float random()
+	{
+		_rand = _rand * 1103515245u + 12345u;
+		return static_cast<float>((_rand >> 8) & 0xffff) / 32767.5f - 1.f;
+	}
+
+	double _timestamp_true{0.};
+	uint32_t _rand{1};
+};
+
+TEST_F(FIFOTimestampFilterTest, FirstBatchPassesThrough)
+{
+	float interval_us = 1000.f;
+	const hrt_abstime timestamp = readBatch(interval_us, 4, 1000., 100.f);
+
+	// nothing to track yet, the measurement and the nominal interval are used as they are
+	EXPECT_NEAR(timestamp, timestampTrue(), 100.);
+	EXPECT_EQ(timestamp, test_now - 2000);
+	EXPECT_FLOAT_EQ(interval_us, 1000.f);
+}
+
+TEST_F(FIFOTimestampFilterTest, LockIn)
+{
+	// sensor clock 0.3% slower than configured
+	const double interval_true_us = 1003.;
+	hrt_abstime timestamp = 0;
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 5000; i++) {
+		interval_us = 1000.f;
+		timestamp = readBatch(interval_us, 4, interval_true_us);
+	}
+
+	EXPECT_NEAR(interval_us, interval_true_us, 0.1);
+	EXPECT_NEAR(timestamp, timestampTrue(), 2.);
+}
+
+TEST_F(FIFOTimestampFilterTest, JitterRejection)
+{
+	const float jitter_us = 200.f;
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 2000; i++) {
+		interval_us = 1000.f;
+		readBatch(interval_us, 4, 1000., jitter_us);
+	}
+
+	double error_squared_sum = 0.;
+	double error_max = 0.;
+	const int batches = 2000;
+
+	for (int i = 0; i < batches; i++) {
+		interval_us = 1000.f;
+		const hrt_abstime timestamp = readBatch(interval_us, 4, 1000., jitter_us);
+		const double error = timestamp - timestampTrue();
+		error_squared_sum += error * error;
+		error_max = math::max(error_max, fabs(error));
+
+		// reconstructed samples stay evenly spaced
+		EXPECT_NEAR(interval_us, 1000.f, 5.f);
+	}
+
+	// at least 3 times below the measurement error RMS (uniform in +-jitter_us: jitter_us / sqrt(3))
+	EXPECT_LT(sqrt(error_squared_sum / batches), static_cast<double>(jitter_us) / sqrt(3.) / 3.);
+	EXPECT_LT(error_max, static_cast<double>(jitter_us) / 2.);
+}
+
+TEST_F(FIFOTimestampFilterTest, DroppedSamples)
+{
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 1000; i++) {
+		interval_us = 1000.f;
+		readBatch(interval_us, 4, 1000.);
+	}
+
+	// FIFO overflow: 20 samples lost before the next read
+	dropSamples(20, 1000.);
+	interval_us = 1000.f;
+	const hrt_abstime timestamp = readBatch(interval_us, 4, 1000.);
+
+	// resynchronized to the measurement
+	EXPECT_EQ(timestamp, static_cast<hrt_abstime>(timestampTrue()));
+	EXPECT_FLOAT_EQ(interval_us, 1000.f);
+
+	// and tracking again from there
+	for (int i = 0; i < 100; i++) {
+		interval_us = 1000.f;
+		const hrt_abstime tracked = readBatch(interval_us, 4, 1000.);
+		EXPECT_NEAR(tracked, timestampTrue(), 1.);
+	}
+}
+
+TEST_F(FIFOTimestampFilterTest, SingleDroppedSample)
+{
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 1000; i++) {
+		interval_us = 1000.f;
+		readBatch(interval_us, 4, 1000., 100.f);
+	}
+
+	// one sample lost: more than half a sample interval off the prediction, which can't be jitter
+	dropSamples(1, 1000.);
+	interval_us = 1000.f;
+	const hrt_abstime timestamp = readBatch(interval_us, 4, 1000.);
+
+	EXPECT_EQ(timestamp, static_cast<hrt_abstime>(timestampTrue()));
+	EXPECT_FLOAT_EQ(interval_us, 1000.f);
+}
+
+TEST_F(FIFOTimestampFilterTest, Reconfigure)
+{
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 100; i++) {
+		interval_us = 1000.f;
+		readBatch(interval_us, 4, 1000.);
+	}
+
+	// sensor switched to a different output data rate
+	interval_us = 500.f;
+	const hrt_abstime timestamp = readBatch(interval_us, 8, 500., 100.f);
+
+	EXPECT_EQ(timestamp, test_now - 2000);
+	EXPECT_FLOAT_EQ(interval_us, 500.f);
+}
+
+TEST_F(FIFOTimestampFilterTest, NeverInTheFuture)
+{
+	float interval_us = 1000.f;
+
+	for (int i = 0; i < 100; i++) {
+		interval_us = 1000.f;
+		readBatch(interval_us, 4, 1000.);
+	}
+
+	// predicted sample ahead of the current time
+	test_now = static_cast<hrt_abstime>(timestampTrue()) + 1000;
+	const hrt_abstime timestamp = _filter.update(static_cast<hrt_abstime>(timestampTrue()) + 4000, 4, interval_us);
+
+	EXPECT_EQ(timestamp, test_now);
+}
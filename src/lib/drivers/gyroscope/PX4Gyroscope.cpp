@@ -119,6 +119,7 @@ void PX4Gyroscope::update(const hrt_abstime &timestamp_sample, float x, float y,
 	sensor_gyro_s report;
 
 	report.timestamp_sample = timestamp_sample;
+	report.timestamp_sample_correction = 0;
 	report.device_id = _device_id;
 	report.temperature = _temperature;
 	report.error_count = _error_count;
@@ -143,6 +144,10 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 		rotate_3i(_rotation, sample.x[n], sample.y[n], sample.z[n]);
 	}
 
+	// replace the jittery measured timestamp and nominal interval with the reconstructed ones
+	const hrt_abstime timestamp_sample_measured = sample.timestamp_sample;
+	sample.timestamp_sample = _timestamp_filter.update(timestamp_sample_measured, N, sample.dt);
+
 	sample.device_id = _device_id;
 	sample.scale = _scale;
 	sample.timestamp = hrt_absolute_time();
@@ -152,6 +157,7 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 	// publish
 	sensor_gyro_s report;
 	report.timestamp_sample = sample.timestamp_sample;
+	report.timestamp_sample_correction = static_cast<int32_t>(static_cast<int64_t>(sample.timestamp_sample - timestamp_sample_measured));
 	report.device_id = _device_id;
 	report.temperature = _temperature;
 	report.error_count = _error_count;
@@ -35,6 +35,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/conversion/rotation.h>
+#include <lib/drivers/device/FIFOTimestampFilter.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fifo.h>
@@ -81,4 +82,6 @@ private:
 	uint32_t		_error_count{0};
 
 	int16_t			_last_sample[3] {};
+
+	FIFOTimestampFilter	_timestamp_filter{};
 };
@@ -3,6 +3,11 @@
  *
  * A simple matrix template library.
  *
+ * The library is portable scalar C++ on purpose and has no intrinsics (NEON/AVX/Cortex-M DSP)
+ * specializations: the Cortex-M7 FPU has no float SIMD, the DSP extension only covers integer q15/q31
+ * data, and the row-major storage of 3-wide rows does not fill 4-lane registers without padding.
+ * On x86-64 and ARM64 the fixed-size loops are left to the compiler's auto-vectorizer.
+ *
  * @author James Goppert <james.goppert@gmail.com>
  */
 
@@ -174,7 +179,7 @@ public:
 
 	// Using this function reduces the number of temporary variables needed to compute A * B.T
 	template<size_t P>
-	Matrix<Type, M, M> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	Matrix<Type, M, P> multiplyByTranspose(const Matrix<Type, P, N> &other) const
 	{
 		Matrix<Type, M, P> res;
 		const Matrix<Type, M, N> &self = *this;
@@ -190,6 +195,64 @@ public:
 		return res;
 	}
 
+	// Computes A.T * B without creating the transposed copy of A
+	template<size_t P>
+	Matrix<Type, N, P> transposeMultiply(const Matrix<Type, M, P> &other) const
+	{
+		Matrix<Type, N, P> res;
+		const Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < N; j++) {
+				for (size_t k = 0; k < P; k++) {
+					res(j, k) += self(i, j) * other(i, k);
+				}
+			}
+		}
+
+		return res;
+	}
+
+	// In place C += scale * A * B, without temporaries
+	// A and B must not alias this matrix
+	template<size_t P>
+	void addProduct(const Matrix<Type, M, P> &a, const Matrix<Type, P, N> &b, Type scale = Type(1))
+	{
+		Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < N; j++) {
+				Type sum{};
+
+				for (size_t k = 0; k < P; k++) {
+					sum += a(i, k) * b(k, j);
+				}
+
+				self(i, j) += scale * sum;
+			}
+		}
+	}
+
+	// In place C += scale * A * B.T, without temporaries
+	// A and B must not alias this matrix
+	template<size_t P>
+	void addProductTranspose(const Matrix<Type, M, P> &a, const Matrix<Type, N, P> &b, Type scale = Type(1))
+	{
+		Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < N; j++) {
+				Type sum{};
+
+				for (size_t k = 0; k < P; k++) {
+					sum += a(i, k) * b(j, k);
+				}
+
+				self(i, j) += scale * sum;
+			}
+		}
+	}
+
 	// Element-wise multiplication
 	Matrix<Type, M, N> emult(const Matrix<Type, M, N> &other) const
 	{
@@ -486,10 +486,11 @@ public:
 	 */
 	Vector3<Type> rotateVector(const Vector3<Type> &vec) const
 	{
+		// closed form of the sandwich product q * v * q^-1, avoids two full quaternion products
 		const Quaternion &q = *this;
-		Quaternion v(Type(0), vec(0), vec(1), vec(2));
-		Quaternion res = q * v * q.inversed();
-		return Vector3<Type>(res(1), res(2), res(3));
+		const Vector3<Type> u = q.imag();
+		const Type w = q(0);
+		return ((w * w - u.dot(u)) * vec + Type(2) * u.dot(vec) * u + Type(2) * w * u.cross(vec)) * (Type(1) / q.dot(q));
 	}
 
 	/**
@@ -503,10 +504,11 @@ public:
 	 */
 	Vector3<Type> rotateVectorInverse(const Vector3<Type> &vec) const
 	{
+		// closed form of the sandwich product q^-1 * v * q, avoids two full quaternion products
 		const Quaternion &q = *this;
-		Quaternion v(Type(0), vec(0), vec(1), vec(2));
-		Quaternion res = q.inversed() * v * q;
-		return Vector3<Type>(res(1), res(2), res(3));
+		const Vector3<Type> u = q.imag();
+		const Type w = q(0);
+		return ((w * w - u.dot(u)) * vec + Type(2) * u.dot(vec) * u - Type(2) * w * u.cross(vec)) * (Type(1) / q.dot(q));
 	}
 
 	/**
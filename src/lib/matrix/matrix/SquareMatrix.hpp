@@ -294,6 +294,30 @@ public:
 		return self.isBlockSymmetric<Width>(first, eps);
 	}
 
+	// Symmetric rank-P update: C += scale * A * A.T
+	// only the lower triangle of A * A.T is computed and mirrored
+	template <size_t P>
+	void addSymmetricProduct(const Matrix<Type, M, P> &a, Type scale = Type(1))
+	{
+		SquareMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j <= i; j++) {
+				Type sum{};
+
+				for (size_t k = 0; k < P; k++) {
+					sum += a(i, k) * a(j, k);
+				}
+
+				self(i, j) += scale * sum;
+
+				if (i != j) {
+					self(j, i) += scale * sum;
+				}
+			}
+		}
+	}
+
 	void copyLowerToUpperTriangle()
 	{
 		SquareMatrix<Type, M> &self = *this;
@@ -460,6 +460,12 @@ TEST(MatrixAttitudeTest, Attitude)
 	EXPECT_EQ(q.rotateVectorInverse(v1), Dcmf(q).T()*v1);
 	EXPECT_EQ(q.rotateVector(v1), Dcmf(q)*v1);
 
+	// rotation by a non-unit quaternion matches the explicit sandwich product
+	const Quatf q_scaled = q * 2.5f;
+	const Quatf v1_quat(0.f, v1(0), v1(1), v1(2));
+	EXPECT_EQ(q_scaled.rotateVector(v1), (q_scaled * v1_quat * q_scaled.inversed()).imag());
+	EXPECT_EQ(q_scaled.rotateVectorInverse(v1), (q_scaled.inversed() * v1_quat * q_scaled).imag());
+
 	AxisAnglef aa_q_init(q);
 	EXPECT_EQ(aa_q_init, AxisAnglef(1.0f, 2.0f, 3.0f));
 
@@ -98,3 +98,46 @@ TEST(MatrixMultiplicationTest, Multiplication)
 	Matrix<float, 4, 2> m42_plus2 = m42 - (-2);
 	EXPECT_EQ(m42_plus2, m42_plus2_check);
 }
+
+TEST(MatrixMultiplicationTest, FusedOperations)
+{
+	float data_43[12] = {1, 3, 2,
+			     2, 2, 1,
+			     5, 2, 1,
+			     2, 3, 4
+			    };
+	float data_23[6] = {2, 1, 5,
+			    3, 7, 4
+			   };
+	float data_42[8] = {1, -2,
+			    0, 3,
+			    4, 1,
+			    -1, 2
+			   };
+
+	Matrix<float, 4, 3> m43(data_43);
+	Matrix<float, 2, 3> m23(data_23);
+	Matrix<float, 4, 2> m42(data_42);
+
+	// A * B.T
+	Matrix<float, 4, 2> m43_m23T = m43.multiplyByTranspose(m23);
+	Matrix<float, 4, 2> m43_m23T_check = m43 * m23.T();
+	EXPECT_EQ(m43_m23T, m43_m23T_check);
+
+	// A.T * B
+	Matrix<float, 3, 2> m43T_m42 = m43.transposeMultiply(m42);
+	Matrix<float, 3, 2> m43T_m42_check = m43.T() * m42;
+	EXPECT_EQ(m43T_m42, m43T_m42_check);
+
+	// C += scale * A * B
+	Matrix<float, 4, 3> C = m43;
+	C.addProduct(m42, m23, -0.5f);
+	Matrix<float, 4, 3> C_check = m43 - m42 * m23 * 0.5f;
+	EXPECT_EQ(C, C_check);
+
+	// C += scale * A * B.T
+	Matrix<float, 4, 2> D = m42;
+	D.addProductTranspose(m43, m23, 2.f);
+	Matrix<float, 4, 2> D_check = m42 + m43 * m23.T() * 2.f;
+	EXPECT_EQ(D, D_check);
+}
@@ -210,3 +210,21 @@ TEST(MatrixSquareTest, Square)
 	M.copyUpperToLowerTriangle();
 	EXPECT_EQ(M, L_check);
 }
+
+TEST(MatrixSquareTest, SymmetricProduct)
+{
+	float data_32[6] = {2, 3,
+			    1, 7,
+			    5, 4
+			   };
+	Matrix<float, 3, 2> A(data_32);
+
+	SquareMatrix<float, 3> P = diag(Vector3f(1.f, 2.f, 3.f));
+	P.addSymmetricProduct(A, 0.5f);
+
+	SquareMatrix<float, 3> P_check = diag(Vector3f(1.f, 2.f, 3.f));
+	P_check += A * A.T() * 0.5f;
+
+	EXPECT_EQ(P, P_check);
+	EXPECT_TRUE(P.isBlockSymmetric<3>(0));
+}
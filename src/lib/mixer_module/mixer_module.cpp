@@ -524,11 +524,13 @@ MixingOutput::limitAndUpdateOutputs(float outputs[MAX_ACTUATORS], bool has_updat
 	}
 
 	/* now return the outputs to the driver */
+	_output_latch_timestamp = 0;
+
 	if (_interface.updateOutputs(_current_output_value, _max_num_outputs, has_updates)) {
 		actuator_outputs_s actuator_outputs{};
 		setAndPublishActuatorOutputs(_max_num_outputs, actuator_outputs);
 
-		updateLatencyPerfCounter(actuator_outputs);
+		updateLatency(actuator_outputs);
 	}
 }
 
@@ -676,16 +678,54 @@ MixingOutput::setAndPublishActuatorOutputs(unsigned num_outputs, actuator_output
 }
 
 void
-MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs)
+MixingOutput::updateLatency(const actuator_outputs_s &actuator_outputs)
 {
 	// Just check the first function. It means we only get the latency if motors are assigned first, which is the default
-	if (_function_allocated[0]) {
-		hrt_abstime timestamp_sample;
+	hrt_abstime timestamp_sample;
+
+	if (_function_allocated[0] && _function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)
+	    && timestamp_sample != _latency_timestamp_sample_last) {
+
+		// only count each sample once, outputs can also get updated by other functions
+		_latency_timestamp_sample_last = timestamp_sample;
+
+		const bool hardware_latch = (_output_latch_timestamp != 0);
+		const hrt_abstime output_time = hardware_latch ? _output_latch_timestamp : actuator_outputs.timestamp;
 
-		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
-			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
+		if (output_time > timestamp_sample) {
+			const uint32_t latency_us = math::min(output_time - timestamp_sample, (hrt_abstime)UINT32_MAX);
+			perf_set_elapsed(_control_latency_perf, latency_us);
+
+			if (_control_latency.count == 0) {
+				_control_latency_interval_start = output_time;
+				_control_latency.latency_min_us = latency_us;
+				_control_latency.latency_max_us = latency_us;
+
+			} else {
+				_control_latency.latency_min_us = math::min(_control_latency.latency_min_us, latency_us);
+				_control_latency.latency_max_us = math::max(_control_latency.latency_max_us, latency_us);
+			}
+
+			const uint32_t bin = math::min(latency_us / control_latency_s::HISTOGRAM_BIN_WIDTH_US,
+						       (uint32_t)control_latency_s::HISTOGRAM_BINS - 1);
+			_control_latency.histogram[bin]++;
+			_control_latency.count++;
+			_control_latency_sum += latency_us;
+			_control_latency.hardware_latch = hardware_latch;
 		}
 	}
+
+	if ((_control_latency.count > 0)
+	    && (actuator_outputs.timestamp >= _control_latency_interval_start + control_latency_s::PUBLISH_INTERVAL_US)) {
+
+		_control_latency.latency_mean_us = (float)_control_latency_sum / _control_latency.count;
+		strncpy(_control_latency.param_prefix, _param_prefix, sizeof(_control_latency.param_prefix) - 1);
+		_control_latency.timestamp = hrt_absolute_time();
+		_control_latency_pub.publish(_control_latency);
+
+		_control_latency = {};
+		_control_latency_sum = 0;
+	}
 }
 
 uint16_t
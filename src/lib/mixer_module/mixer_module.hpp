@@ -59,6 +59,7 @@
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/actuator_armed.h>
 #include <uORB/topics/actuator_outputs.h>
+#include <uORB/topics/control_latency.h>
 #include <uORB/topics/parameter_update.h>
 
 using namespace time_literals;
@@ -205,6 +206,13 @@ public:
 	 */
 	uint32_t reversibleOutputs() const { return _reversible_mask; }
 
+	/**
+	 * Output drivers call this from updateOutputs() right after the new values got latched into the hardware
+	 * (e.g. after triggering the timers), so that the control latency covers the full path from the gyro sample
+	 * to the motor signal. If not called, the time at which updateOutputs() returned is used instead.
+	 */
+	void outputLatched() { _output_latch_timestamp = hrt_absolute_time(); }
+
 protected:
 	void updateParams() override;
 	uint16_t output_limit_calc_single(int i, float value) const;
@@ -218,7 +226,7 @@ private:
 
 	void setAndPublishActuatorOutputs(unsigned num_outputs, actuator_outputs_s &actuator_outputs);
 	void publishMixerStatus(const actuator_outputs_s &actuator_outputs);
-	void updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs);
+	void updateLatency(const actuator_outputs_s &actuator_outputs);
 
 	void cleanupFunctions();
 
@@ -262,6 +270,7 @@ private:
 	uORB::Subscription _armed_sub{ORB_ID(actuator_armed)};
 
 	uORB::PublicationMulti<actuator_outputs_s> _outputs_pub{ORB_ID(actuator_outputs)};
+	uORB::PublicationMulti<control_latency_s> _control_latency_pub{ORB_ID(control_latency)};
 
 	actuator_armed_s _armed{};
 
@@ -280,6 +289,12 @@ private:
 
 	perf_counter_t _control_latency_perf;
 
+	control_latency_s _control_latency{}; ///< latency statistics of the current publication interval
+	uint64_t _control_latency_sum{0};
+	hrt_abstime _control_latency_interval_start{0};
+	hrt_abstime _latency_timestamp_sample_last{0};
+	hrt_abstime _output_latch_timestamp{0}; ///< set by the driver through outputLatched()
+
 	FunctionProviderBase *_function_allocated[MAX_ACTUATORS] {}; ///< unique allocated functions
 	FunctionProviderBase *_functions[MAX_ACTUATORS] {}; ///< currently assigned functions
 	OutputFunction _function_assignment[MAX_ACTUATORS] {};
@@ -34,9 +34,11 @@
 #include <px4_platform_common/module_params.h>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/obstacle_distance.h>
+#include <uORB/topics/parameter_update.h>
 #include <uORB/uORBManager.hpp>
 
 #include <gtest/gtest.h>
+#include <sys/stat.h>
 
 class ParameterTest : public ::testing::Test
 {
@@ -79,6 +81,205 @@ TEST_F(ParameterTest, testParamReadWrite)
 }
 
 
+TEST_F(ParameterTest, testParamGeneration)
+{
+	// GIVEN: a parameter and the current change generation
+	param_t param = param_handle(px4::params::CP_DIST);
+	const uint32_t generation = param_generation();
+
+	// WHEN: we set the parameter to its current value
+	float value = -1.f;
+	param_set(param, &value);
+
+	// THEN: the generation should not change
+	EXPECT_EQ(generation, param_generation());
+
+	// WHEN: we change the parameter
+	value = 42.f;
+	param_set(param, &value);
+
+	// THEN: the parameter should be tagged with the new generation
+	EXPECT_EQ(generation + 1, param_generation());
+	EXPECT_EQ(generation + 1, param_get_generation(param));
+
+	// WHEN: we reset the parameter
+	param_reset(param);
+
+	// THEN: the reset counts as a change as well
+	EXPECT_EQ(generation + 2, param_generation());
+	EXPECT_EQ(generation + 2, param_get_generation(param));
+}
+
+class ParameterTestModule : public ModuleParams
+{
+public:
+	ParameterTestModule() : ModuleParams(nullptr) {}
+
+	void update() { updateParams(); }
+	bool changed(const parameter_update_s &update) { return paramsChanged(update); }
+
+	float cp_dist() const { return _param_cp_dist.get(); }
+	void set_cp_dist_locally(float value) { _param_cp_dist.set(value); }
+
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::CP_DIST>) _param_cp_dist
+	)
+};
+
+TEST_F(ParameterTest, testModuleParamsUpdate)
+{
+	// GIVEN: a module using a parameter
+	ParameterTestModule module;
+	EXPECT_FLOAT_EQ(-1.f, module.cp_dist());
+
+	// WHEN: we change the parameter and the module updates
+	float value = 42.f;
+	param_set(param_handle(px4::params::CP_DIST), &value);
+	module.update();
+
+	// THEN: the module should have the new value
+	EXPECT_FLOAT_EQ(42.f, module.cp_dist());
+
+	// WHEN: the module modifies its copy without committing and updates
+	module.set_cp_dist_locally(7.f);
+	module.update();
+
+	// THEN: the stored value should be restored
+	EXPECT_FLOAT_EQ(42.f, module.cp_dist());
+
+	// WHEN: the parameter is reset
+	param_reset(param_handle(px4::params::CP_DIST));
+	module.update();
+
+	// THEN: the module should have the default value again
+	EXPECT_FLOAT_EQ(-1.f, module.cp_dist());
+}
+
+TEST_F(ParameterTest, testModuleParamsChanged)
+{
+	// GIVEN: a module using a parameter and a parameter_update subscriber
+	ParameterTestModule module;
+	uORB::Subscription parameter_update_sub{ORB_ID(parameter_update)};
+	parameter_update_s update{};
+	parameter_update_sub.copy(&update);
+	module.changed(update);
+
+	// WHEN: another parameter changes
+	float value = 1.f;
+	param_set(param_handle(px4::params::CP_DELAY), &value);
+	ASSERT_TRUE(parameter_update_sub.update(&update));
+
+	// THEN: the notification lists it, and the module does not need to update
+	EXPECT_EQ(1, update.changed_params_count);
+	EXPECT_EQ(param_handle(px4::params::CP_DELAY), update.changed_params[0]);
+	EXPECT_FALSE(module.changed(update));
+
+	// WHEN: the parameter of the module changes
+	value = 42.f;
+	param_set(param_handle(px4::params::CP_DIST), &value);
+	ASSERT_TRUE(parameter_update_sub.update(&update));
+
+	// THEN: the module needs to update
+	EXPECT_TRUE(module.changed(update));
+
+	// WHEN: the notification about the parameter of the module is missed
+	value = 7.f;
+	param_set(param_handle(px4::params::CP_DIST), &value);
+	parameter_update_sub.update(&update);
+	value = 3.f;
+	param_set(param_handle(px4::params::CP_DELAY), &value);
+	ASSERT_TRUE(parameter_update_sub.update(&update));
+
+	// THEN: the module cannot rely on the changed set and needs to update
+	EXPECT_TRUE(module.changed(update));
+}
+
+TEST_F(ParameterTest, testSaveJournal)
+{
+	// GIVEN: a default file with a saved parameter
+	const char *filename = "parameter_test.bson";
+	const char *journal = "parameter_test.bson.journal";
+	unlink(filename);
+	unlink(journal);
+	param_set_default_file(filename);
+
+	const param_t param = param_handle(px4::params::CP_DIST);
+	float value = 42.f;
+	param_set(param, &value);
+	ASSERT_EQ(0, param_save_default(true));
+
+	struct stat st {};
+	ASSERT_EQ(0, stat(filename, &st));
+	const off_t file_size = st.st_size;
+	EXPECT_NE(0, stat(journal, &st)); // a full rewrite leaves no journal behind
+
+	// WHEN: we change the parameter and save again
+	value = 7.f;
+	param_set(param, &value);
+	ASSERT_EQ(0, param_save_default(true));
+
+	// THEN: the change is appended to the journal instead of rewriting the default file
+	ASSERT_EQ(0, stat(filename, &st));
+	EXPECT_EQ(file_size, st.st_size);
+	ASSERT_EQ(0, stat(journal, &st));
+	EXPECT_GT(st.st_size, 0);
+
+	// WHEN: we change the parameter without saving and load the default file
+	value = 1.f;
+	param_set(param, &value);
+	EXPECT_EQ(0, param_load_default());
+
+	// THEN: the journaled value should be restored
+	float value_loaded = 0.f;
+	param_get(param, &value_loaded);
+	EXPECT_FLOAT_EQ(7.f, value_loaded);
+
+	param_set_default_file(nullptr);
+	unlink(filename);
+	unlink(journal);
+}
+
+TEST_F(ParameterTest, testExportDefaultRemovesJournal)
+{
+	// GIVEN: a default file with a journaled change
+	const char *filename = "parameter_test.bson";
+	const char *journal = "parameter_test.bson.journal";
+	unlink(filename);
+	unlink(journal);
+	param_set_default_file(filename);
+
+	const param_t param = param_handle(px4::params::CP_DIST);
+	float value = 42.f;
+	param_set(param, &value);
+	ASSERT_EQ(0, param_save_default(true));
+	value = 7.f;
+	param_set(param, &value);
+	ASSERT_EQ(0, param_save_default(true));
+
+	struct stat st {};
+	ASSERT_EQ(0, stat(journal, &st));
+
+	// WHEN: we export to the default file directly
+	value = 3.f;
+	param_set(param, &value);
+	ASSERT_EQ(0, param_export(filename, nullptr));
+
+	// THEN: the journal is gone and loading the default file restores the exported value
+	EXPECT_NE(0, stat(journal, &st));
+
+	value = 1.f;
+	param_set(param, &value);
+	EXPECT_EQ(0, param_load_default());
+
+	float value_loaded = 0.f;
+	param_get(param, &value_loaded);
+	EXPECT_FLOAT_EQ(3.f, value_loaded);
+
+	param_set_default_file(nullptr);
+	unlink(filename);
+	unlink(journal);
+}
+
 TEST_F(ParameterTest, testUorbSendReceive)
 {
 	// GIVEN: a uOrb message
@@ -49,7 +49,11 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <sys/types.h>
+#if defined(CONSTRAINED_MEMORY)
 #include "../DynamicSparseLayer.h"
+#else
+#include "../ExhaustiveLayer.h"
+#endif
 
 __BEGIN_DECLS
 
@@ -58,7 +62,11 @@ __BEGIN_DECLS
  * the param_values and 2 functions to be global
  */
 
+#if defined(CONSTRAINED_MEMORY)
 __EXPORT extern DynamicSparseLayer user_config;
+#else
+__EXPORT extern ExhaustiveLayer user_config;
+#endif
 __EXPORT int param_set_external(param_t param, const void *val, bool mark_saved, bool notify_changes);
 __EXPORT void param_get_external(param_t param, void *val);
 
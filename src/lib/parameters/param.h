@@ -397,6 +397,9 @@ __EXPORT const char	*param_get_default_file(void);
 /**
  * Set the backup parameter file name.
  *
+ * The backup file is written along with a full rewrite of the default file. With a journal, it
+ * can therefore lag behind the default file by up to one journal's worth of changes.
+ *
  * @param filename	Path to the backup parameter file. The file is not required to
  *			exist.
  * @return		Zero on success.
@@ -415,7 +418,10 @@ __EXPORT const char	*param_get_backup_file(void);
  *
  * Note: this method requires a large amount of stack size!
  *
- * This function saves all parameters with non-default values.
+ * This function saves all parameters with non-default values. If possible, only the parameters
+ * changed since the last save are appended to a journal next to the default file (<default file>.journal),
+ * which is compacted into the default file once it grows too large. The journal is removed before the
+ * default file is rewritten, so a stale journal is never applied on top of a newer default file.
  *
  * @param blocking	If true, in case the default file is busy, the function blocks
  * 			until the file is available for writing.
@@ -425,12 +431,21 @@ __EXPORT const char	*param_get_backup_file(void);
 __EXPORT int 		param_save_default(bool blocking);
 
 /**
- * Load parameters from the default parameter file.
+ * Load parameters from the default parameter file, including the changes in its journal.
+ * All other parameters are reset.
  *
  * @return		Zero on success.
  */
 __EXPORT int 		param_load_default(void);
 
+/**
+ * Import parameters from the default parameter file, including the changes in its journal.
+ * Unlike param_load_default(), the other parameters are kept.
+ *
+ * @return		Zero on success.
+ */
+__EXPORT int 		param_import_default(void);
+
 /**
  * Generate the hash of all parameters and their values
  *
@@ -438,6 +453,28 @@ __EXPORT int 		param_load_default(void);
  */
 __EXPORT uint32_t	param_hash_check(void);
 
+/**
+ * Get the current parameter change generation.
+ *
+ * The generation is incremented for every parameter value change (including resets
+ * and parameters that become used) and starts at 0 on boot.
+ *
+ * @return		Current change generation
+ */
+__EXPORT uint32_t	param_generation(void);
+
+/**
+ * Get the change generation at which a parameter was last changed.
+ *
+ * Used to find all parameters that changed since a given generation. Boards with
+ * constrained memory do not track individual parameters and always return the
+ * current generation.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ * @return		The generation of the last change, 0 if unchanged since boot.
+ */
+__EXPORT uint32_t	param_get_generation(param_t param);
+
 /**
  * Print the status of the param system
  *
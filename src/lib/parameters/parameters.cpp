@@ -55,6 +55,7 @@
 #include <drivers/drv_hrt.h>
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/atomic_bitset.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/posix.h>
@@ -93,16 +94,38 @@ inline static int flash_param_import() { return -1; }
 
 static char *param_default_file = nullptr;
 static char *param_backup_file = nullptr;
+static char *param_journal_file = nullptr;	///< changes appended since the default file was last written
+static ssize_t param_journal_size{-1};		///< size of the valid journal records, -1 if the journal needs a compaction
+#define PARAM_JOURNAL_SUFFIX ".journal"
 
 #include "autosave.h"
 static ParamAutosave *autosave_instance {nullptr};
 
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_unsaved;
+static px4::AtomicBitset<param_info_count> params_unjournaled;	// changed since the last save to the default file
+
+static px4::atomic<uint32_t> params_generation{0};	///< incremented on every parameter change
+
+// generation of the last change per parameter (4 bytes per parameter, not kept on CONSTRAINED_MEMORY boards)
+#if !defined(CONSTRAINED_MEMORY)
+static uint32_t params_changed_generation[param_info_count] {};
+#endif
+
+// parameters changed since the last parameter_update notification (published as its changed set)
+static pthread_mutex_t changes_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint16_t params_pending_changes[parameter_update_s::CHANGED_PARAMS_MAX];
+static uint8_t params_pending_count{0};	///< CHANGED_PARAMS_ALL on overflow
+static uint32_t params_notified_generation{0};
 
 static ConstLayer firmware_defaults;
 static DynamicSparseLayer runtime_defaults{&firmware_defaults};
+#if defined(CONSTRAINED_MEMORY)
 DynamicSparseLayer user_config{&runtime_defaults};
+#else
+// flat array of all current values: param_get() is a single indexed load instead of a search per layer
+ExhaustiveLayer user_config{&runtime_defaults};
+#endif
 
 /** parameter update topic handle */
 #if not defined(CONFIG_PARAM_REMOTE)
@@ -167,6 +190,20 @@ param_notify_changes()
 	pup.active = params_active.count();
 	pup.changed = user_config.size();
 	pup.custom_default = runtime_defaults.size();
+
+	pthread_mutex_lock(&changes_mutex);
+	pup.previous_generation = params_notified_generation;
+	pup.generation = params_generation.load();
+	pup.changed_params_count = params_pending_count;
+
+	if (params_pending_count != parameter_update_s::CHANGED_PARAMS_ALL) {
+		memcpy(pup.changed_params, params_pending_changes, params_pending_count * sizeof(params_pending_changes[0]));
+	}
+
+	params_notified_generation = pup.generation;
+	params_pending_count = 0;
+	pthread_mutex_unlock(&changes_mutex);
+
 	pup.timestamp = hrt_absolute_time();
 
 	if (param_topic == nullptr) {
@@ -179,6 +216,62 @@ param_notify_changes()
 #endif
 }
 
+static void
+param_mark_changed(param_t param)
+{
+	pthread_mutex_lock(&changes_mutex);
+
+	// the generation is incremented together with the pending set, so that a notification covers both consistently
+	const uint32_t generation = params_generation.fetch_add(1) + 1;
+
+	if (params_pending_count != parameter_update_s::CHANGED_PARAMS_ALL) {
+		bool pending = false;
+
+		for (int i = 0; i < params_pending_count; i++) {
+			if (params_pending_changes[i] == param) {
+				pending = true;
+				break;
+			}
+		}
+
+		if (!pending) {
+			if (params_pending_count < parameter_update_s::CHANGED_PARAMS_MAX) {
+				params_pending_changes[params_pending_count++] = param;
+
+			} else {
+				params_pending_count = parameter_update_s::CHANGED_PARAMS_ALL;
+			}
+		}
+	}
+
+#if !defined(CONSTRAINED_MEMORY)
+	params_changed_generation[param] = generation;
+#else
+	(void)generation;
+#endif
+
+	pthread_mutex_unlock(&changes_mutex);
+}
+
+uint32_t param_generation()
+{
+	return params_generation.load();
+}
+
+uint32_t param_get_generation(param_t param)
+{
+	if (!handle_in_range(param)) {
+		return 0;
+	}
+
+#if !defined(CONSTRAINED_MEMORY)
+	return params_changed_generation[param];
+#else
+	// no per parameter tracking: report every parameter as changed with the latest change
+	return params_generation.load();
+#endif
+}
+
 static param_t param_find_internal(const char *name, bool notification)
 {
 	perf_count(param_find_perf);
@@ -437,10 +530,18 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 		}
 	}
 
+	// cached copies (Param<>) are only refreshed for marked parameters, so mark any stored difference
+	const bool value_differs = user_config_value.i != new_value.i;
+
 	if (user_config.store(param, new_value)) {
 		params_unsaved.set(param, !mark_saved && param_changed);
 		result = PX4_OK;
 
+		if (value_differs) {
+			param_mark_changed(param);
+			params_unjournaled.set(param, true);
+		}
+
 	} else {
 		PX4_ERR("param_set failed to store param %s", param_name(param));
 		result = PX4_ERROR;
@@ -528,7 +629,12 @@ void param_set_used(param_t param)
 
 #endif
 
-		params_active.set(param, true);
+		if (!params_active[param]) {
+			params_active.set(param, true);
+
+			// newly listed parameters need to be picked up by incremental syncs as well
+			param_mark_changed(param);
+		}
 	}
 }
 
@@ -569,6 +675,7 @@ int param_set_default_value(param_t param, const void *val)
 
 	if (setting_to_static_default) {
 		runtime_defaults.reset(param);
+		user_config.refresh(param);
 
 		result = PX4_OK;
 
@@ -600,6 +707,13 @@ int param_set_default_value(param_t param, const void *val)
 	}
 
 
+	if (result == PX4_OK) {
+		param_mark_changed(param);
+
+		// the default file only stores values differing from the runtime defaults
+		params_unjournaled.set(param, true);
+	}
+
 	if ((result == PX4_OK) && param_used(param)) {
 		// send notification if param is already in use
 		param_notify_changes();
@@ -619,6 +733,11 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 
 	if (handle_in_range(param)) {
 		user_config.reset(param);
+
+		if (param_found) {
+			param_mark_changed(param);
+			params_unjournaled.set(param, true);
+		}
 	}
 
 	if (autosave) {
@@ -737,10 +856,25 @@ param_set_default_file(const char *filename)
 		param_default_file = nullptr;
 	}
 
+	if (param_journal_file != nullptr) {
+		free(param_journal_file);
+		param_journal_file = nullptr;
+	}
+
 	if (filename) {
 		param_default_file = strdup(filename);
+
+		const size_t journal_file_len = strlen(filename) + sizeof(PARAM_JOURNAL_SUFFIX);
+		param_journal_file = (char *)malloc(journal_file_len);
+
+		if (param_journal_file) {
+			snprintf(param_journal_file, journal_file_len, "%s" PARAM_JOURNAL_SUFFIX, filename);
+		}
 	}
 
+	// the journal needs to be validated by param_load_default() before it can be appended to
+	param_journal_size = -1;
+
 #endif /* FLASH_BASED_PARAMS */
 
 	return 0;
@@ -781,6 +915,10 @@ const char *param_get_backup_file()
 
 static int param_export_internal(int fd, param_filter_func filter);
 static int param_verify(int fd);
+static int param_import_internal(int fd);
+static int param_journal_append();
+static int param_journal_remove();
+static void param_journal_replay();
 
 int param_save_default(bool blocking)
 {
@@ -804,12 +942,28 @@ int param_save_default(bool blocking)
 	}
 
 	int res = PX4_ERROR;
+	bool compacted = false;
 	const char *filename = param_get_default_file();
 
 	if (filename) {
+		// append the changes to the journal if possible, which is a lot cheaper than rewriting the whole file
+		perf_begin(param_export_perf);
+		res = param_journal_append();
+		perf_end(param_export_perf);
+	}
+
+	if (filename && (res != PX4_OK)) {
 		static constexpr int MAX_ATTEMPTS = 3;
 
-		for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
+		// all the changes are written to the default file below
+		params_unjournaled.reset();
+		compacted = true;
+
+		// the journal has to be gone before the default file is rewritten, replaying it on top of the new file
+		// (after a power loss during the rewrite or a failed clean up) would revert the newer values
+		const bool journal_removed = (param_journal_remove() == PX4_OK);
+
+		for (int attempt = 1; journal_removed && (attempt <= MAX_ATTEMPTS); attempt++) {
 			// write parameters to file
 			int fd = ::open(filename, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
 
@@ -836,7 +990,11 @@ int param_save_default(bool blocking)
 			}
 		}
 
-	} else {
+		if (res != PX4_OK) {
+			param_journal_size = -1;
+		}
+
+	} else if (!filename) {
 		perf_begin(param_export_perf);
 		res = flash_param_save(nullptr);
 		perf_end(param_export_perf);
@@ -848,8 +1006,8 @@ int param_save_default(bool blocking)
 	} else {
 		params_unsaved.reset();
 
-		// backup file
-		if (param_backup_file) {
+		// backup file (only along with the default file, not for every journal append)
+		if (param_backup_file && compacted) {
 			int fd_backup_file = ::open(param_backup_file, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
 
 			if (fd_backup_file > -1) {
@@ -879,23 +1037,41 @@ int param_save_default(bool blocking)
 }
 
 /**
+ * @param import keep the values of parameters not stored in the default file, instead of resetting them
  * @return 0 on success, 1 if all params have not yet been stored, -1 if device open failed, -2 if writing parameters failed
  */
-int
-param_load_default()
+static int
+param_load_default_internal(bool import)
 {
 	int res = 0;
 	const char *filename = param_get_default_file();
 
 	if (!filename) {
-		return flash_param_load();
+		return import ? flash_param_import() : flash_param_load();
+	}
+
+	pthread_mutex_lock(&file_mutex);
+
+	// changes not stored yet, which need to remain pending if they are not overwritten by the default file
+	px4::Bitset<param_info_count> unjournaled;
+
+	if (import) {
+		for (param_t param = 0; handle_in_range(param); param++) {
+			unjournaled.set(param, params_unjournaled[param]);
+		}
 	}
 
+	// until the journal is validated below, the next save has to rewrite the default file
+	param_journal_size = -1;
+
 	int fd_load = ::open(filename, O_RDONLY);
 
 	if (fd_load < 0) {
+		const bool file_missing = (errno == ENOENT);
+		pthread_mutex_unlock(&file_mutex);
+
 		/* no parameter file is OK, otherwise this is an error */
-		if (errno != ENOENT) {
+		if (!file_missing) {
 			PX4_ERR("open '%s' for reading failed", filename);
 			return -1;
 		}
@@ -903,17 +1079,46 @@ param_load_default()
 		return 1;
 	}
 
-	int result = param_load(fd_load);
+	int result = import ? param_import_internal(fd_load) : param_load(fd_load);
 	::close(fd_load);
 
 	if (result != 0) {
+		pthread_mutex_unlock(&file_mutex);
 		PX4_ERR("error reading parameters from '%s'", filename);
 		return -2;
 	}
 
+	// apply the changes saved since the default file was written
+	param_journal_replay();
+
+	// the loaded values are stored already
+	params_unjournaled.reset();
+
+	if (import) {
+		for (param_t param = 0; handle_in_range(param); param++) {
+			if (unjournaled[param]) {
+				params_unjournaled.set(param, true);
+			}
+		}
+	}
+
+	pthread_mutex_unlock(&file_mutex);
+
 	return res;
 }
 
+int
+param_load_default()
+{
+	return param_load_default_internal(false);
+}
+
+int
+param_import_default()
+{
+	return param_load_default_internal(true);
+}
+
 static int param_verify_callback(bson_decoder_t decoder, bson_node_t node)
 {
 	if (node->type == BSON_EOO) {
@@ -1035,9 +1240,29 @@ param_export(const char *filename, param_filter_func filter)
 		return PX4_ERROR;
 	}
 
-	int fd = ::open(filename, O_RDWR | O_CREAT, PX4_O_MODE_666);
 	int result = PX4_ERROR;
 
+	// exporting to the default file replaces it: as in param_save_default() the journal has to be gone first,
+	// otherwise it would be replayed on top of the new file on the next boot and revert the newer values
+	if (param_default_file && (strcmp(filename, param_default_file) == 0)) {
+		if (param_journal_remove() != PX4_OK) {
+			pthread_mutex_unlock(&file_mutex);
+
+			if (shutdown_lock_ret == 0) {
+				px4_shutdown_unlock();
+			}
+
+			return PX4_ERROR;
+		}
+
+		if (!filter) {
+			// all the changes are written to the default file below
+			params_unjournaled.reset();
+		}
+	}
+
+	int fd = ::open(filename, O_RDWR | O_CREAT, PX4_O_MODE_666);
+
 	perf_begin(param_export_perf);
 
 	if (fd > -1) {
@@ -1265,6 +1490,229 @@ param_import_internal(int fd)
 	return -1;
 }
 
+/**
+ * Journal record, appended to the journal file for every parameter changed since the last save.
+ * The records are replayed on top of the default file, the last record of a parameter wins.
+ */
+struct __attribute__((packed)) param_journal_record_s {
+	uint8_t type;		///< PARAM_TYPE_INT32, PARAM_TYPE_FLOAT or JOURNAL_RECORD_RESET
+	char name[16];		///< parameter name, not null-terminated if it uses all 16 characters
+	union {
+		int32_t i;
+		float f;
+	} value;		///< same size on all platforms, unlike param_value_u
+	uint32_t crc;		///< crc32 over all the previous fields, to detect records torn by a power loss
+};
+
+static constexpr uint8_t JOURNAL_RECORD_RESET = 0xff;	///< the parameter is reset to its (runtime) default
+static constexpr ssize_t JOURNAL_MAX_SIZE = 100 * sizeof(param_journal_record_s);	///< compact above this size
+
+static uint32_t param_journal_record_crc(const param_journal_record_s &record)
+{
+	return crc32part((const uint8_t *)&record, offsetof(param_journal_record_s, crc), 0);
+}
+
+static void param_journal_record_fill(param_t param, param_journal_record_s &record)
+{
+	record = {};
+	strncpy(record.name, param_name(param), sizeof(record.name));
+
+	const param_value_u runtime_default_value = runtime_defaults.get(param);
+	const param_value_u user_config_value = user_config.get(param);
+	bool is_default = !user_config.contains(param);
+
+	// same as the export, values equal to the runtime default are not stored
+	switch (param_type(param)) {
+	case PARAM_TYPE_INT32:
+		is_default = is_default || (user_config_value.i == runtime_default_value.i);
+		break;
+
+	case PARAM_TYPE_FLOAT:
+		is_default = is_default || (fabsf(user_config_value.f - runtime_default_value.f) <= FLT_EPSILON);
+		break;
+	}
+
+	if (is_default) {
+		record.type = JOURNAL_RECORD_RESET;
+
+	} else {
+		record.type = param_type(param);
+		record.value.i = user_config_value.i;
+	}
+
+	record.crc = param_journal_record_crc(record);
+}
+
+// append all unjournaled changes to the journal, caller is responsible for locking
+static int param_journal_append()
+{
+	if (!param_journal_file || (param_journal_size < 0)) {
+		return PX4_ERROR;
+	}
+
+	const ssize_t size = param_journal_size + params_unjournaled.count() * sizeof(param_journal_record_s);
+
+	if (size > JOURNAL_MAX_SIZE) {
+		// compact into the default file instead
+		return PX4_ERROR;
+	}
+
+	if (size == param_journal_size) {
+		return PX4_OK;
+	}
+
+	int fd = ::open(param_journal_file, O_WRONLY | O_CREAT | O_APPEND, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_DEBUG("journal open failed (%d)", errno);
+		param_journal_size = -1;
+		return PX4_ERROR;
+	}
+
+	param_journal_record_s records[8];
+	int num_records = 0;
+	int result = PX4_OK;
+
+	for (param_t param = 0; handle_in_range(param) && (result == PX4_OK); param++) {
+		if (!params_unjournaled[param]) {
+			continue;
+		}
+
+		// clear before reading the value, so that concurrent changes are picked up by the next save
+		params_unjournaled.set(param, false);
+		param_journal_record_fill(param, records[num_records++]);
+
+		if (num_records == (int)(sizeof(records) / sizeof(records[0]))) {
+			const ssize_t len = num_records * sizeof(records[0]);
+
+			if (::write(fd, records, len) != len) {
+				result = PX4_ERROR;
+
+			} else {
+				param_journal_size += len;
+			}
+
+			num_records = 0;
+		}
+	}
+
+	if ((result == PX4_OK) && (num_records > 0)) {
+		const ssize_t len = num_records * sizeof(records[0]);
+
+		if (::write(fd, records, len) != len) {
+			result = PX4_ERROR;
+
+		} else {
+			param_journal_size += len;
+		}
+	}
+
+	if ((result == PX4_OK) && (fsync(fd) != 0)) {
+		result = PX4_ERROR;
+	}
+
+	::close(fd);
+
+	if (result != PX4_OK) {
+		PX4_ERR("journal append to %s failed (%d)", param_journal_file, errno);
+		// possibly a partial record at the end: rewrite the default file instead (which covers all the changes)
+		param_journal_size = -1;
+	}
+
+	return result;
+}
+
+// remove the journal before the default file is rewritten, caller is responsible for locking
+static int param_journal_remove()
+{
+	if (param_journal_file && (::unlink(param_journal_file) != 0) && (errno != ENOENT)) {
+		PX4_ERR("journal remove %s failed (%d)", param_journal_file, errno);
+		param_journal_size = -1;
+		return PX4_ERROR;
+	}
+
+	param_journal_size = 0;
+	return PX4_OK;
+}
+
+// apply the journal on top of the loaded default file, caller is responsible for locking
+static void param_journal_replay()
+{
+	if (!param_journal_file) {
+		return;
+	}
+
+	int fd = ::open(param_journal_file, O_RDWR);
+
+	if (fd < 0) {
+		if (errno == ENOENT) {
+			param_journal_size = 0;
+		}
+
+		return;
+	}
+
+	param_journal_record_s record;
+	ssize_t valid_size = 0;
+	int num_records = 0;
+
+	while (::read(fd, &record, sizeof(record)) == sizeof(record)) {
+		if (record.crc != param_journal_record_crc(record)) {
+			break;
+		}
+
+		valid_size += sizeof(record);
+		num_records++;
+
+		bson_node_s node{};
+		memcpy(node.name, record.name, sizeof(record.name));
+
+		if (record.type == JOURNAL_RECORD_RESET) {
+			param_t param = param_find_no_notification(node.name);
+
+			if (param != PARAM_INVALID) {
+				param_reset_internal(param, true, false);
+			}
+
+			continue;
+		}
+
+		// same handling as importing from the default file (including translations of renamed parameters)
+		if (record.type == PARAM_TYPE_INT32) {
+			node.type = BSON_INT32;
+			node.i32 = record.value.i;
+
+		} else if (record.type == PARAM_TYPE_FLOAT) {
+			node.type = BSON_DOUBLE;
+			node.d = (double)record.value.f;
+
+		} else {
+			continue;
+		}
+
+		param_import_callback(nullptr, &node);
+	}
+
+	const off_t file_size = lseek(fd, 0, SEEK_END);
+
+	if (file_size != valid_size) {
+		// a save got interrupted: drop the incomplete records, so that new records can be appended
+		PX4_WARN("journal: dropping %d bytes of invalid records", (int)(file_size - valid_size));
+
+		if (ftruncate(fd, valid_size) != 0) {
+			valid_size = -1;
+		}
+	}
+
+	::close(fd);
+
+	if (num_records > 0) {
+		PX4_INFO("journal: applied %d records", num_records);
+	}
+
+	param_journal_size = valid_size;
+}
+
 int
 param_import(int fd)
 {
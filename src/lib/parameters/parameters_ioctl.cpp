@@ -178,6 +178,12 @@ int	param_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case PARAMIOCIMPORTDEFAULT: {
+			paramiocimportdefault_t *data = (paramiocimportdefault_t *)arg;
+			data->ret = param_import_default();
+		}
+		break;
+
 	case PARAMIOCEXPORT: {
 			paramiocexport_t *data = (paramiocexport_t *)arg;
 			data->ret = param_export(data->filename, nullptr);
@@ -190,6 +196,18 @@ int	param_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case PARAMIOCGENERATION: {
+			paramiocgeneration_t *data = (paramiocgeneration_t *)arg;
+			data->ret = param_generation();
+		}
+		break;
+
+	case PARAMIOCGETGENERATION: {
+			paramiocgetgeneration_t *data = (paramiocgetgeneration_t *)arg;
+			data->ret = param_get_generation(data->param);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 		break;
@@ -149,6 +149,11 @@ typedef struct paramiocloaddefault {
 	int ret;
 } paramiocloaddefault_t;
 
+#define PARAMIOCIMPORTDEFAULT	_PARAMIOC(21)
+typedef struct paramiocimportdefault {
+	int ret;
+} paramiocimportdefault_t;
+
 
 #define PARAMIOCEXPORT	_PARAMIOC(17)
 typedef struct paramiocexport {
@@ -161,4 +166,15 @@ typedef struct paramiochash {
 	uint32_t ret;
 } paramiochash_t;
 
+#define PARAMIOCGENERATION	_PARAMIOC(19)
+typedef struct paramiocgeneration {
+	uint32_t ret;
+} paramiocgeneration_t;
+
+#define PARAMIOCGETGENERATION	_PARAMIOC(20)
+typedef struct paramiocgetgeneration {
+	const param_t param;
+	uint32_t ret;
+} paramiocgetgeneration_t;
+
 int param_ioctl(unsigned int cmd, unsigned long arg);
@@ -202,6 +202,14 @@ param_load_default()
 	return data.ret;
 }
 
+int
+param_import_default()
+{
+	paramiocimportdefault_t data = {PX4_ERROR};
+	boardctl(PARAMIOCIMPORTDEFAULT, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
 int
 param_export(const char *filename, param_filter_func filter)
 {
@@ -219,3 +227,17 @@ uint32_t param_hash_check()
 	boardctl(PARAMIOCHASH, reinterpret_cast<unsigned long>(&data));
 	return data.ret;
 }
+
+uint32_t param_generation()
+{
+	paramiocgeneration_t data = {0};
+	boardctl(PARAMIOCGENERATION, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
+uint32_t param_get_generation(param_t param)
+{
+	paramiocgetgeneration_t data = {param, 0};
+	boardctl(PARAMIOCGETGENERATION, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
@@ -85,6 +85,7 @@ ControlAllocator::~ControlAllocator()
 	delete _actuator_effectiveness;
 
 	perf_free(_loop_perf);
+	perf_free(_allocate_perf);
 }
 
 bool
@@ -182,6 +183,10 @@ ControlAllocator::update_allocation_method(bool force)
 				_control_allocation[i] = new ControlAllocationSequentialDesaturation();
 				break;
 
+			case AllocationMethod::ACTIVE_SET:
+				_control_allocation[i] = new ControlAllocationActiveSet();
+				break;
+
 			default:
 				PX4_ERR("Unknown allocation method");
 				break;
@@ -429,7 +434,9 @@ ControlAllocator::Run()
 			_control_allocation[i]->setControlSetpoint(c[i]);
 
 			// Do allocation
+			perf_begin(_allocate_perf);
 			_control_allocation[i]->allocate();
+			perf_end(_allocate_perf);
 			_actuator_effectiveness->allocateAuxilaryControls(dt, i, _control_allocation[i]->_actuator_sp); //flaps and spoilers
 			_actuator_effectiveness->updateSetpoint(c[i], i, _control_allocation[i]->_actuator_sp,
 								_control_allocation[i]->getActuatorMin(), _control_allocation[i]->getActuatorMax());
@@ -811,6 +818,10 @@ int ControlAllocator::print_status()
 	case AllocationMethod::AUTO:
 		PX4_INFO("Method: Auto");
 		break;
+
+	case AllocationMethod::ACTIVE_SET:
+		PX4_INFO("Method: Active set (constrained weighted least-squares)");
+		break;
 	}
 
 	// Print current airframe
@@ -939,6 +950,7 @@ int ControlAllocator::print_status()
 
 	// Print perf
 	perf_print_counter(_loop_perf);
+	perf_print_counter(_allocate_perf);
 
 	return 0;
 }
@@ -56,6 +56,7 @@
 #include <ActuatorEffectivenessSpacecraft.hpp>
 
 #include <ControlAllocation.hpp>
+#include <ControlAllocationActiveSet.hpp>
 #include <ControlAllocationPseudoInverse.hpp>
 #include <ControlAllocationSequentialDesaturation.hpp>
 
@@ -204,6 +205,7 @@ private:
 	uint16_t _motor_stop_mask{0};
 
 	perf_counter_t	_loop_perf;			/**< loop duration performance counter */
+	perf_counter_t	_allocate_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": allocate")}; /**< allocation solver duration */
 
 	bool _armed{false};
 	hrt_abstime _last_run{0};
@@ -45,7 +45,9 @@ void OutputPredictor::print_status()
 	printf("[output predictor] IMU dt: %.6f, EKF dt: %.6f\n",
 	       (double)_dt_update_states_avg, (double)_dt_correct_states_avg);
 
-	const matrix::Quatf q_att = _output_buffer.get_newest().quat_nominal;
+	const outputSample output_newest = getCorrectedSample(_output_buffer.get_newest());
+
+	const matrix::Quatf q_att = output_newest.quat_nominal;
 	const matrix::Eulerf euler = q_att;
 
 	printf("[output predictor] orientation: [%.4f, %.4f, %.4f, %.4f] (Euler [%.3f, %.3f, %.3f])\n",
@@ -53,12 +55,10 @@ void OutputPredictor::print_status()
 	       (double)euler.phi(), (double)euler.theta(), (double)euler.psi());
 
 	printf("[output predictor] velocity: [%.3f, %.3f, %.3f]\n",
-	       (double)_output_buffer.get_newest().vel(0), (double)_output_buffer.get_newest().vel(1),
-	       (double)_output_buffer.get_newest().vel(2));
+	       (double)output_newest.vel(0), (double)output_newest.vel(1), (double)output_newest.vel(2));
 
 	printf("[output predictor] position: [%.3f, %.3f, %.3f]\n",
-	       (double)_output_buffer.get_newest().pos(0), (double)_output_buffer.get_newest().pos(1),
-	       (double)_output_buffer.get_newest().pos(2));
+	       (double)output_newest.pos(0), (double)output_newest.pos(1), (double)output_newest.pos(2));
 
 	printf("[output predictor] tracking error, angular: %.6f rad, velocity: %.4f m/s, position: %.4f m\n",
 	       (double)_output_tracking_error(0), (double)_output_tracking_error(1), (double)_output_tracking_error(2));
@@ -72,7 +72,7 @@ void OutputPredictor::print_status()
 
 void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f &vel_state, const LatLonAlt &gpos_state)
 {
-	const outputSample &output_delayed = _output_buffer.get_oldest();
+	const outputSample output_delayed = getCorrectedSample(_output_buffer.get_oldest());
 
 	// calculate the quaternion rotation delta from the EKF to output observer states at the EKF fusion time horizon
 	Quatf q_delta{quat_state * output_delayed.quat_nominal.inversed()};
@@ -85,15 +85,17 @@ void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f
 	const Vector3f pos_delta = -output_delayed.pos;
 	_global_ref = gpos_state;
 
-	// loop through the output filter state history and add the deltas
+	// loop through the output filter state history and add the attitude delta
 	for (uint8_t i = 0; i < _output_buffer.get_length(); i++) {
 		_output_buffer[i].quat_nominal = q_delta * _output_buffer[i].quat_nominal;
 		_output_buffer[i].quat_nominal.normalize();
-		_output_buffer[i].vel += vel_delta;
-		_output_buffer[i].pos += pos_delta;
 	}
 
-	_output_new = _output_buffer.get_newest();
+	// the velocity and position deltas apply to the whole history
+	_vel_correction_sum += vel_delta;
+	_pos_correction_sum += pos_delta;
+
+	_output_new = getCorrectedSample(_output_buffer.get_newest());
 }
 
 void OutputPredictor::reset()
@@ -123,6 +125,10 @@ void OutputPredictor::reset()
 
 	_output_tracking_error.setZero();
 
+	_vel_correction_sum.setZero();
+	_pos_correction_sum.setZero();
+	_pushes_since_rebase = 0;
+
 	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index] = {};
 	}
@@ -146,17 +152,16 @@ void OutputPredictor::resetQuaternion(const Quatf &quat_change)
 
 void OutputPredictor::resetHorizontalVelocityTo(const Vector2f &delta_horz_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		_output_buffer[index].vel.xy() += delta_horz_vel;
-	}
+	_vel_correction_sum.xy() += delta_horz_vel;
 
 	_output_new.vel.xy() += delta_horz_vel;
 }
 
 void OutputPredictor::resetVerticalVelocityTo(float delta_vert_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		_output_buffer[index].vel(2) += delta_vert_vel;
+	_vel_correction_sum(2) += delta_vert_vel;
+
+	for (uint8_t index = 0; index < _output_vert_buffer.get_length(); index++) {
 		_output_vert_buffer[index].vert_vel += delta_vert_vel;
 	}
 
@@ -280,7 +285,14 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	_gyro_bias = gyro_bias;
 	_accel_bias = accel_bias;
 
+	// keep the accumulated corrections small, the buffer has been replaced completely since the last rebase
+	if (++_pushes_since_rebase >= _output_buffer.get_length()) {
+		rebaseOutputBuffer();
+	}
+
 	// store the INS states in a ring buffer with the same length and time coordinates as the IMU data buffer
+	_output_new.vel_correction_sum = _vel_correction_sum;
+	_output_new.pos_correction_sum = _pos_correction_sum;
 	_output_buffer.push(_output_new);
 	_output_vert_buffer.push(_output_vert_new);
 
@@ -288,7 +300,7 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	// this data will be at the EKF fusion time horizon
 	// TODO: there is no guarantee that data is at delayed fusion horizon
 	//       Shouldnt we use pop_first_older_than?
-	const outputSample &output_delayed = _output_buffer.get_oldest();
+	const outputSample output_delayed = getCorrectedSample(_output_buffer.get_oldest());
 	const outputVert &output_vert_delayed = _output_vert_buffer.get_oldest();
 
 	// calculate the quaternion delta between the INS and EKF quaternions at the EKF fusion time horizon
@@ -311,7 +323,7 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	_output_tracking_error(0) = delta_ang_error.norm();
 
 	/*
-	* Loop through the output filter state history and apply the corrections to the velocity and position states.
+	* Apply the corrections to the velocity and position states of the whole output filter state history.
 	* This method is too expensive to use for the attitude states due to the quaternion operations required
 	* but because it eliminates the time delay in the 'correction loop' it allows higher tracking gains
 	* to be used and reduces tracking error relative to EKF states.
@@ -392,17 +404,26 @@ void OutputPredictor::applyCorrectionToVerticalOutputBuffer(const float vert_vel
 
 void OutputPredictor::applyCorrectionToOutputBuffer(const Vector3f &vel_correction, const Vector3f &pos_correction)
 {
-	// loop through the output filter state history and apply the corrections to the velocity and position states
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		// a constant velocity correction is applied
-		_output_buffer[index].vel += vel_correction;
+	// a constant velocity and position correction is applied to the whole output filter state history,
+	// accumulate it instead of looping through the buffer (see getCorrectedSample())
+	_vel_correction_sum += vel_correction;
+	_pos_correction_sum += pos_correction;
+
+	// update output state to corrected values
+	_output_new = getCorrectedSample(_output_buffer.get_newest());
+}
 
-		// a constant position correction is applied
-		_output_buffer[index].pos += pos_correction;
+void OutputPredictor::rebaseOutputBuffer()
+{
+	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+		_output_buffer[index] = getCorrectedSample(_output_buffer[index]);
+		_output_buffer[index].vel_correction_sum.setZero();
+		_output_buffer[index].pos_correction_sum.setZero();
 	}
 
-	// update output state to corrected values
-	_output_new = _output_buffer.get_newest();
+	_vel_correction_sum.setZero();
+	_pos_correction_sum.setZero();
+	_pushes_since_rebase = 0;
 }
 
 matrix::Vector3f OutputPredictor::getVelocityDerivative() const
@@ -136,6 +136,7 @@ private:
 	* state history and propagates vert_vel_integ forward in time using the corrected vert_vel history.
 	* This provides an alternative vertical velocity output that is closer to the first derivative
 	* of the position but does degrade tracking relative to the EKF state.
+	* The re-integrated positions are not a constant offset, so this walks the whole buffer on every call.
 	*/
 	void applyCorrectionToVerticalOutputBuffer(float vert_vel_correction, const float pos_ref_change);
 
@@ -146,6 +147,13 @@ private:
 	*/
 	void applyCorrectionToOutputBuffer(const matrix::Vector3f &vel_correction, const matrix::Vector3f &pos_correction);
 
+	/*
+	* Apply the accumulated velocity and position corrections to every buffered sample and restart the accumulation
+	* from zero. Called once per buffer length of pushed samples, so that the accumulated values stay small.
+	* This is a full pass over the buffer on that update.
+	*/
+	void rebaseOutputBuffer();
+
 	// return the square of two floating point numbers - used in auto coded sections
 	static constexpr float sq(float var) { return var * var; }
 
@@ -154,6 +162,8 @@ private:
 		matrix::Quatf    quat_nominal{1.f, 0.f, 0.f, 0.f}; ///< nominal quaternion describing vehicle attitude
 		matrix::Vector3f vel{0.f, 0.f, 0.f};               ///< NED velocity estimate in earth frame (m/sec)
 		matrix::Vector3f pos{0.f, 0.f, 0.f};               ///< NED position estimate in earth frame (m/sec)
+		matrix::Vector3f vel_correction_sum{};             ///< accumulated velocity correction when the sample was buffered (m/sec)
+		matrix::Vector3f pos_correction_sum{};             ///< accumulated position correction when the sample was buffered (m)
 	};
 
 	struct outputVert {
@@ -163,11 +173,28 @@ private:
 		float    dt{0.f};             ///< delta time (sec)
 	};
 
+	// return a buffered output sample with all the velocity and position corrections applied since it was buffered
+	outputSample getCorrectedSample(const outputSample &sample) const
+	{
+		outputSample corrected{sample};
+		corrected.vel += _vel_correction_sum - sample.vel_correction_sum;
+		corrected.pos += _pos_correction_sum - sample.pos_correction_sum;
+		corrected.vel_correction_sum = _vel_correction_sum;
+		corrected.pos_correction_sum = _pos_correction_sum;
+		return corrected;
+	}
+
 	LatLonAlt _global_ref{0.0, 0.0, 0.f};
 
 	TimestampedRingBuffer<outputSample> _output_buffer{12};
 	TimestampedRingBuffer<outputVert> _output_vert_buffer{12};
 
+	// Velocity and position corrections are applied to the whole output buffer. Instead of walking the buffer,
+	// they are accumulated here and each buffered sample is corrected by the difference to its own snapshot on read.
+	matrix::Vector3f _vel_correction_sum{};
+	matrix::Vector3f _pos_correction_sum{};
+	uint8_t _pushes_since_rebase{0};	///< samples pushed to the output buffer since the last rebaseOutputBuffer()
+
 	matrix::Vector3f _accel_bias{};
 	matrix::Vector3f _gyro_bias{};
 
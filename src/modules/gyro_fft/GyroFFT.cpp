@@ -141,6 +141,24 @@ bool GyroFFT::init()
 	if (buffers_allocated) {
 		_imu_gyro_fft_len = _param_imu_gyro_fft_len.get();
 
+		// hop length between consecutive FFTs of an axis (window overlap 1 - 1/IMU_GYRO_FFT_OVL)
+		switch (_param_imu_gyro_fft_ovl.get()) {
+		case 2:
+		case 4:
+		case 8:
+			_fft_hop_length = _imu_gyro_fft_len / _param_imu_gyro_fft_ovl.get();
+			break;
+
+		default:
+			PX4_ERR("Invalid IMU_GYRO_FFT_OVL=%" PRId32 ", resetting", _param_imu_gyro_fft_ovl.get());
+			_param_imu_gyro_fft_ovl.set(4);
+			_param_imu_gyro_fft_ovl.commit();
+			_fft_hop_length = _imu_gyro_fft_len / 4;
+			break;
+		}
+
+		ResetBuffers();
+
 		// init Hanning window
 		for (int n = 0; n < _imu_gyro_fft_len; n++) {
 			const float hanning_value = 0.5f * (1.f - cosf(2.f * M_PI_F * n / (_imu_gyro_fft_len - 1)));
@@ -336,9 +354,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -347,9 +363,7 @@ void GyroFFT::Run()
 
 			if (fabsf(sensor_gyro_fifo.scale - _fifo_last_scale) > FLT_EPSILON) {
 				// force reset if scale has changed
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
@@ -365,9 +379,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_sub.update(&sensor_gyro)) {
 			if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -392,40 +404,72 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
+void GyroFFT::ResetBuffers()
+{
+	_fft_buffer_index = 0;
+	_fft_buffer_samples = 0;
+
+	// stagger the axes by a third of the hop length so FFTs are spread evenly across cycles
+	for (int axis = 0; axis < 3; axis++) {
+		_fft_samples_until_update[axis] = _imu_gyro_fft_len + (axis * _fft_hop_length) / 3;
+	}
+}
+
 void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
 {
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
-	for (int axis = 0; axis < 3; axis++) {
-		int &buffer_index = _fft_buffer_index[axis];
+	// append new samples to the ring buffer of each axis
+	for (int n = 0; n < N; n++) {
+		for (int axis = 0; axis < 3; axis++) {
+			// convert int16_t -> q15_t (scaling isn't relevant)
+			gyro_data_buffer[axis][_fft_buffer_index] = input[axis][n] / 2;
+			_fft_samples_until_update[axis]--;
+		}
 
-		for (int n = 0; n < N; n++) {
-			if (buffer_index < _imu_gyro_fft_len) {
-				// convert int16_t -> q15_t (scaling isn't relevant)
-				gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
-				buffer_index++;
-			}
+		_fft_buffer_index = (_fft_buffer_index + 1) % _imu_gyro_fft_len;
+		_fft_buffer_samples = math::min(_fft_buffer_samples + 1, (int)_imu_gyro_fft_len);
+	}
 
-			// if we have enough samples begin processing, but only one FFT per cycle
-			if ((buffer_index >= _imu_gyro_fft_len) && !_fft_updated) {
-				perf_begin(_fft_perf);
+	if (_fft_updated || (_fft_buffer_samples < _imu_gyro_fft_len)) {
+		return;
+	}
 
-				arm_mult_q15(gyro_data_buffer[axis], _hanning_window, _fft_input_buffer, _imu_gyro_fft_len);
-				arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+	// only one FFT per cycle, pick the most overdue axis
+	int axis = 0;
 
-				_fft_updated = true;
+	for (int i = 1; i < 3; i++) {
+		if (_fft_samples_until_update[i] < _fft_samples_until_update[axis]) {
+			axis = i;
+		}
+	}
 
-				FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+	if (_fft_samples_until_update[axis] <= 0) {
+		perf_begin(_fft_perf);
 
-				// reset
-				// shift buffer (3/4 overlap)
-				const int overlap_start = _imu_gyro_fft_len / 4;
-				memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
-				buffer_index = overlap_start * 3;
+		// apply window to the ring buffer starting from the oldest sample
+		const int oldest = _fft_buffer_index;
+		const int len_tail = _imu_gyro_fft_len - oldest;
+		arm_mult_q15(&gyro_data_buffer[axis][oldest], _hanning_window, _fft_input_buffer, len_tail);
 
-				perf_end(_fft_perf);
-			}
+		if (oldest > 0) {
+			arm_mult_q15(gyro_data_buffer[axis], &_hanning_window[len_tail], &_fft_input_buffer[len_tail], oldest);
+		}
+
+		arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+
+		_fft_updated = true;
+
+		FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+
+		// schedule next update, without trying to catch up if we've fallen behind
+		_fft_samples_until_update[axis] += _fft_hop_length;
+
+		if (_fft_samples_until_update[axis] <= 0) {
+			_fft_samples_until_update[axis] = _fft_hop_length;
 		}
+
+		perf_end(_fft_perf);
 	}
 }
 
@@ -702,7 +746,8 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 
 int GyroFFT::print_status()
 {
-	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+	PX4_INFO("gyro sample rate: %.3f Hz, FFT length: %" PRId32 ", hop length: %d", (double)_gyro_sample_rate_hz,
+		 _imu_gyro_fft_len, _fft_hop_length);
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
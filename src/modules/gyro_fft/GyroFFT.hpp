@@ -88,6 +88,7 @@ private:
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
 	inline void Publish();
+	void ResetBuffers();
 	bool SensorSelectionUpdate(bool force = false);
 	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
@@ -147,7 +148,13 @@ private:
 
 	float _fifo_last_scale{0};
 
-	int _fft_buffer_index[3] {};
+	// ring buffer write index shared by all axes
+	int _fft_buffer_index{0};
+	int _fft_buffer_samples{0};
+
+	// samples remaining until the next FFT per axis (staggered so updates are spread evenly)
+	int _fft_samples_until_update[3] {};
+	int _fft_hop_length{64};
 
 	unsigned _gyro_last_generation{0};
 
@@ -164,6 +171,7 @@ private:
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
+		(ParamInt<px4::params::IMU_GYRO_FFT_OVL>) _param_imu_gyro_fft_ovl,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
@@ -75,6 +75,22 @@ PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_MAX, 150.f);
 */
 PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 
+/**
+* IMU gyro FFT window overlap.
+*
+* The FFT of each axis is recomputed every IMU_GYRO_FFT_LEN / IMU_GYRO_FFT_OVL samples
+* over the most recent IMU_GYRO_FFT_LEN samples. Updates of the three axes are
+* staggered so the work is spread evenly. Higher overlap reduces the latency of
+* the peak frequency estimates at the cost of more CPU.
+*
+* @value 2 50%
+* @value 4 75%
+* @value 8 87.5%
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_OVL, 4);
+
 /**
 * IMU gyro FFT SNR.
 *
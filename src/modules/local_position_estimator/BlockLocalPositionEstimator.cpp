@@ -973,8 +973,13 @@ void BlockLocalPositionEstimator::predict(const sensor_combined_s &imu)
 
 	// propagate
 	_x += dx;
-	Matrix<float, n_x, n_x> dP = (m_A * m_P + m_P * m_A.transpose() +
-				      m_B * m_R * m_B.transpose() + m_Q) * getDt();
+
+	// dP = (A * P + P * A^T + B * R * B^T + Q) * dt, accumulated in place
+	Matrix<float, n_x, n_x> dP = m_Q;
+	dP.addProduct(m_A, m_P);
+	dP.addProductTranspose(m_P, m_A);
+	dP.addProductTranspose(m_B * m_R, m_B);
+	dP *= getDt();
 
 	// covariance propagation logic
 	for (size_t i = 0; i < n_x; i++) {
@@ -139,10 +139,10 @@ void LogWriter::stop_log_file(LogType type)
 	}
 }
 
-void LogWriter::start_log_mavlink()
+void LogWriter::start_log_mavlink(bool compressed)
 {
 	if (_log_writer_mavlink) {
-		_log_writer_mavlink->start_log();
+		_log_writer_mavlink->start_log(compressed);
 	}
 }
 
@@ -71,7 +71,10 @@ public:
 
 	bool had_file_write_error() const;
 
-	void start_log_mavlink();
+	/**
+	 * @param compressed stream the data section compressed (see ulog_stream_s::FORMAT_ULOG_COMPRESSED)
+	 */
+	void start_log_mavlink(bool compressed = false);
 
 	void stop_log_mavlink();
 
@@ -140,6 +143,18 @@ public:
 		return 0;
 	}
 
+	size_t get_bytes_published_mavlink() const
+	{
+		if (_log_writer_mavlink) { return _log_writer_mavlink->bytes_published(); }
+
+		return 0;
+	}
+
+	bool is_compressed_mavlink() const
+	{
+		return _log_writer_mavlink && _log_writer_mavlink->compressed();
+	}
+
 	pthread_t thread_id_file() const
 	{
 		if (_log_writer_file) { return _log_writer_file->thread_id(); }
@@ -60,9 +60,11 @@ LogWriterMavlink::~LogWriterMavlink()
 	if (_ulog_stream_ack_sub >= 0) {
 		orb_unsubscribe(_ulog_stream_ack_sub);
 	}
+
+	delete _encoder;
 }
 
-void LogWriterMavlink::start_log()
+void LogWriterMavlink::start_log(bool compressed)
 {
 	if (_ulog_stream_ack_sub == -1) {
 		_ulog_stream_ack_sub = orb_subscribe(ORB_ID(ulog_stream_ack));
@@ -76,13 +78,37 @@ void LogWriterMavlink::start_log()
 	_ulog_stream_data.length = 0;
 	_ulog_stream_data.first_message_offset = 0;
 
+	delete _encoder;
+	_encoder = nullptr;
+	_block_size = 0;
+	_bytes_published = 0;
+
+	if (compressed) {
+		_encoder = new heatshrink_encoder;
+
+		if (_encoder == nullptr) {
+			PX4_ERR("alloc failed, streaming uncompressed");
+		}
+	}
+
 	_is_started = true;
 }
 
 void LogWriterMavlink::stop_log()
 {
+	if (_is_started && _encoder && !_need_reliable_transfer) {
+		// close the open block and send out what the encoder still holds, otherwise the log tail is lost
+		if (finish_block() == 0 && _ulog_stream_data.length > 0) {
+			publish_message();
+		}
+	}
+
 	_ulog_stream_data.length = 0;
 	_is_started = false;
+
+	delete _encoder;
+	_encoder = nullptr;
+	_block_size = 0;
 }
 
 int LogWriterMavlink::write_message(void *ptr, size_t size)
@@ -91,6 +117,10 @@ int LogWriterMavlink::write_message(void *ptr, size_t size)
 		return 0;
 	}
 
+	if (_encoder && !_need_reliable_transfer) {
+		return write_compressed((const uint8_t *)ptr, size);
+	}
+
 	const uint8_t data_len = (uint8_t)sizeof(_ulog_stream_data.data);
 	uint8_t *ptr_data = (uint8_t *)ptr;
 
@@ -115,8 +145,102 @@ int LogWriterMavlink::write_message(void *ptr, size_t size)
 	return 0;
 }
 
+int LogWriterMavlink::write_compressed(const uint8_t *ptr, size_t size)
+{
+	// blocks may only start in a message without a block start, the receiver can only locate one per message
+	if (_block_size >= COMPRESSED_BLOCK_SIZE && _ulog_stream_data.first_message_offset == 255) {
+		if (finish_block()) {
+			return -2;
+		}
+	}
+
+	if (_block_size == 0) {
+		if (_ulog_stream_data.length >= sizeof(_ulog_stream_data.data)) {
+			if (publish_message()) {
+				return -2;
+			}
+		}
+
+		// a block starts with the encoder configuration, so it can be decoded without any prior state
+		heatshrink_encoder_reset(_encoder);
+		_ulog_stream_data.first_message_offset = _ulog_stream_data.length;
+		_ulog_stream_data.data[_ulog_stream_data.length++] = (HEATSHRINK_STATIC_WINDOW_BITS << 4) |
+				HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+	}
+
+	size_t sunk_total = 0;
+
+	while (sunk_total < size) {
+		size_t sunk = 0;
+
+		if (heatshrink_encoder_sink(_encoder, (uint8_t *)ptr + sunk_total, size - sunk_total, &sunk) < 0) {
+			return -2;
+		}
+
+		sunk_total += sunk;
+
+		if (drain_encoder()) {
+			return -2;
+		}
+	}
+
+	_block_size += size;
+	return 0;
+}
+
+int LogWriterMavlink::drain_encoder()
+{
+	const size_t data_len = sizeof(_ulog_stream_data.data);
+	HSE_poll_res pres;
+
+	do {
+		size_t output_size = 0;
+		pres = heatshrink_encoder_poll(_encoder, _ulog_stream_data.data + _ulog_stream_data.length,
+					       data_len - _ulog_stream_data.length, &output_size);
+
+		if (pres < 0) {
+			return -2;
+		}
+
+		_ulog_stream_data.length += output_size;
+
+		if (_ulog_stream_data.length >= data_len) {
+			if (publish_message()) {
+				return -2;
+			}
+		}
+	} while (pres == HSER_POLL_MORE);
+
+	return 0;
+}
+
+int LogWriterMavlink::finish_block()
+{
+	if (_block_size == 0) {
+		return 0;
+	}
+
+	while (heatshrink_encoder_finish(_encoder) == HSER_FINISH_MORE) {
+		if (drain_encoder()) {
+			return -2;
+		}
+	}
+
+	_block_size = 0;
+	return 0;
+}
+
 void LogWriterMavlink::set_need_reliable_transfer(bool need_reliable)
 {
+	if (need_reliable && !_need_reliable_transfer && _encoder) {
+		// compressed data is never acked: close the block and send it out before switching to plain ULog
+		finish_block();
+
+		if (_ulog_stream_data.length > 0) {
+			publish_message();
+		}
+	}
+
 	if (!need_reliable && _need_reliable_transfer) {
 		if (_ulog_stream_data.length > 0) {
 			// make sure to send previous data using reliable transfer
@@ -137,6 +261,7 @@ int LogWriterMavlink::publish_message()
 	}
 
 	_ulog_stream_pub.publish(_ulog_stream_data);
+	_bytes_published += _ulog_stream_data.length;
 
 	if (_need_reliable_transfer) {
 		// we need to wait for an ack. Note that this blocks the main logger thread, so if a file logging
@@ -38,6 +38,9 @@
 #include <uORB/topics/ulog_stream.h>
 #include <uORB/topics/ulog_stream_ack.h>
 
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
+
 namespace px4
 {
 namespace logger
@@ -55,7 +58,10 @@ public:
 
 	bool init();
 
-	void start_log();
+	/**
+	 * @param compressed send unacked data as compressed blocks (ulog_stream_s::FORMAT_ULOG_COMPRESSED)
+	 */
+	void start_log(bool compressed = false);
 
 	void stop_log();
 
@@ -71,11 +77,34 @@ public:
 		return _need_reliable_transfer;
 	}
 
+	bool compressed() const { return _encoder != nullptr; }
+
+	/** number of bytes published since the start of the log, used to shape the logged topic rates */
+	size_t bytes_published() const { return _bytes_published; }
+
 private:
 
 	/** publish message, wait for ack if needed & reset message */
 	int publish_message();
 
+	int write_compressed(const uint8_t *ptr, size_t size);
+
+	/** move encoder output into the message, publishing full messages */
+	int drain_encoder();
+
+	/** flush the encoder and close the current block */
+	int finish_block();
+
+	/**
+	 * Uncompressed size after which a new block is started (at the next ULog message boundary).
+	 * Each block can be decoded on its own, so a lost message only loses the rest of its block.
+	 */
+	static constexpr size_t COMPRESSED_BLOCK_SIZE = 1024;
+
+	heatshrink_encoder *_encoder{nullptr}; ///< only allocated for compressed streaming
+	size_t _block_size{0}; ///< uncompressed bytes in the current block, 0 if no block is open
+	size_t _bytes_published{0};
+
 	ulog_stream_s _ulog_stream_data{};
 	uORB::Publication<ulog_stream_s> _ulog_stream_pub{ORB_ID(ulog_stream)};
 	int _ulog_stream_ack_sub{-1};
@@ -209,7 +209,13 @@ int Logger::print_status()
 	}
 
 	if (_writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
-		PX4_INFO("Mavlink Logging Running (Full log)");
+		PX4_INFO("Mavlink Logging Running (Full log%s)", _writer.is_compressed_mavlink() ? ", compressed" : "");
+
+		if (_mavlink_target_rate > 0) {
+			PX4_INFO("\ttarget rate: %" PRIu32 " B/s, min topic interval: %.3f s", _mavlink_target_rate,
+				 (double)(_mavlink_min_interval * 1e-6f));
+		}
+
 		is_logging = true;
 	}
 
@@ -416,6 +422,7 @@ Logger::~Logger()
 
 	delete[](_msg_buffer);
 	delete[](_subscriptions);
+	delete[](_mavlink_next_write);
 }
 
 void Logger::update_params()
@@ -746,6 +753,10 @@ void Logger::run()
 				}
 			}
 
+			if (_mavlink_next_write) {
+				update_mavlink_rate_shaping(loop_time);
+			}
+
 			/* wait for lock on log buffer */
 			_writer.lock();
 
@@ -771,7 +782,13 @@ void Logger::run()
 
 					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
 
-					// full log
+					// full log (skipping the mavlink stream if the topic is above the shaped rate)
+					const bool mavlink_due = mavlink_topic_due(sub_idx, loop_time);
+
+					if (!mavlink_due) {
+						_writer.select_write_backend(LogWriter::BackendFile);
+					}
+
 					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
 
 #ifdef DBGPRINT
@@ -779,6 +796,10 @@ void Logger::run()
 #endif /* DBGPRINT */
 					}
 
+					if (!mavlink_due) {
+						_writer.unselect_write_backend();
+					}
+
 					// mission log
 					if (sub_idx < _num_mission_subs) {
 						if (_writer.is_started(LogType::Mission)) {
@@ -1176,12 +1197,15 @@ void Logger::handle_vehicle_command_update()
 
 		if (command.command == vehicle_command_s::VEHICLE_CMD_LOGGING_START) {
 
-			if ((int)(command.param1 + 0.5f) != 0) {
+			const int format = (int)(command.param1 + 0.5f);
+
+			if (format != ulog_stream_s::FORMAT_ULOG && format != ulog_stream_s::FORMAT_ULOG_COMPRESSED) {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_UNSUPPORTED);
 
 			} else if (can_start_mavlink_log()) {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
-				start_log_mavlink();
+				start_log_mavlink(format == ulog_stream_s::FORMAT_ULOG_COMPRESSED,
+						  PX4_ISFINITE(command.param2) && command.param2 > 0.f ? (uint32_t)command.param2 : 0);
 
 			} else {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_TEMPORARILY_REJECTED);
@@ -1468,7 +1492,7 @@ void Logger::stop_log_file(LogType type)
 	_writer.stop_log_file(type);
 }
 
-void Logger::start_log_mavlink()
+void Logger::start_log_mavlink(bool compressed, uint32_t target_rate)
 {
 	if (!can_start_mavlink_log()) {
 		return;
@@ -1481,9 +1505,9 @@ void Logger::start_log_mavlink()
 	// initialize cpu load as early as possible to get more data
 	initialize_load_output(PrintLoadReason::Preflight);
 
-	PX4_INFO("Start mavlink log");
+	PX4_INFO("Start mavlink log%s", compressed ? " (compressed)" : "");
 
-	_writer.start_log_mavlink();
+	_writer.start_log_mavlink(compressed);
 	_writer.select_write_backend(LogWriter::BackendMavlink);
 	_writer.set_need_reliable_transfer(true);
 	write_header(LogType::Full);
@@ -1500,9 +1524,67 @@ void Logger::start_log_mavlink()
 	_writer.unselect_write_backend();
 	_writer.notify();
 
+	delete[](_mavlink_next_write);
+	_mavlink_next_write = nullptr;
+	_mavlink_target_rate = target_rate;
+
+	if (target_rate > 0) {
+		_mavlink_next_write = new hrt_abstime[_num_subscriptions] {};
+
+		if (_mavlink_next_write == nullptr) {
+			PX4_ERR("alloc failed, not shaping mavlink log rate");
+		}
+	}
+
+	// start at 10 Hz per topic and let the rate shaping converge from there
+	_mavlink_min_interval = 100_ms;
+	_mavlink_rate_check = hrt_absolute_time();
+	_mavlink_bytes_at_check = _writer.get_bytes_published_mavlink();
+
 	adjust_subscription_updates(); // redistribute updates as sending the header can take some time
 }
 
+void Logger::update_mavlink_rate_shaping(const hrt_abstime &now)
+{
+	static constexpr hrt_abstime UPDATE_INTERVAL = 1_s;
+	static constexpr uint32_t MAX_INTERVAL = 5_s;
+
+	if (now < _mavlink_rate_check + UPDATE_INTERVAL) {
+		return;
+	}
+
+	const size_t bytes = _writer.get_bytes_published_mavlink();
+	const float rate = (bytes - _mavlink_bytes_at_check) / ((now - _mavlink_rate_check) * 1e-6f);
+	const float ratio = rate / _mavlink_target_rate;
+
+	if (ratio > 1.f) {
+		// over budget: back off proportionally (this includes the share of the unshaped messages)
+		_mavlink_min_interval = math::min((uint32_t)(math::max(_mavlink_min_interval, (uint32_t)10_ms)
+						  * math::min(ratio, 2.f)), MAX_INTERVAL);
+
+	} else if (ratio < 0.8f) {
+		// headroom left: slowly let the fast topics through again
+		_mavlink_min_interval = (_mavlink_min_interval < 1_ms) ? 0 : (uint32_t)(_mavlink_min_interval * 0.8f);
+	}
+
+	_mavlink_rate_check = now;
+	_mavlink_bytes_at_check = bytes;
+}
+
+bool Logger::mavlink_topic_due(int sub_idx, const hrt_abstime &now)
+{
+	if (_mavlink_next_write == nullptr) {
+		return true;
+	}
+
+	if (now < _mavlink_next_write[sub_idx]) {
+		return false;
+	}
+
+	_mavlink_next_write[sub_idx] = now + _mavlink_min_interval;
+	return true;
+}
+
 void Logger::stop_log_mavlink()
 {
 	// don't write perf data since a client does not expect more data after a stop command
@@ -1517,6 +1599,10 @@ void Logger::stop_log_mavlink()
 		_writer.notify();
 		_writer.stop_log_mavlink();
 	}
+
+	delete[](_mavlink_next_write);
+	_mavlink_next_write = nullptr;
+	_mavlink_target_rate = 0;
 }
 
 struct perf_callback_data_t {
@@ -217,7 +217,11 @@ private:
 
 	void stop_log_file(LogType type);
 
-	void start_log_mavlink();
+	/**
+	 * @param compressed stream the data section as compressed blocks
+	 * @param target_rate data rate the logged topics are shaped to [B/s], 0 to stream at the configured rates
+	 */
+	void start_log_mavlink(bool compressed, uint32_t target_rate);
 
 	void stop_log_mavlink();
 
@@ -339,6 +343,16 @@ private:
 
 	void adjust_subscription_updates();
 
+	/**
+	 * Adjust the minimum topic interval for mavlink streaming to the measured output rate
+	 */
+	void update_mavlink_rate_shaping(const hrt_abstime &now);
+
+	/**
+	 * @return true if an updated topic should be written to the mavlink stream
+	 */
+	bool mavlink_topic_due(int sub_idx, const hrt_abstime &now);
+
 	uint8_t						*_msg_buffer{nullptr};
 	int						_msg_buffer_len{0};
 
@@ -357,6 +371,14 @@ private:
 	int						_num_subscriptions{0};
 	MissionSubscription 				_mission_subscriptions[MAX_MISSION_TOPICS_NUM] {}; ///< additional data for mission subscriptions
 	int						_num_mission_subs{0};
+
+	// mavlink streaming rate shaping: a common minimum interval caps the fast topics first, so slow topics
+	// are streamed completely while the total stays within the target rate
+	hrt_abstime					*_mavlink_next_write{nullptr}; ///< per subscription, only allocated when shaping
+	uint32_t					_mavlink_target_rate{0}; ///< [B/s]
+	uint32_t					_mavlink_min_interval{0}; ///< [us]
+	hrt_abstime					_mavlink_rate_check{0};
+	size_t						_mavlink_bytes_at_check{0};
 	LoggerSubscription				_event_subscription; ///< Subscription for the event topic (handled separately)
 	uint16_t 					_event_sequence_offset{0}; ///< event sequence offset to account for skipped (not logged) messages
 	uint16_t 					_event_sequence_offset_mission{0};
@@ -43,6 +43,7 @@
 #include <cstring>
 
 #include "mavlink_ftp.h"
+#include "mavlink_param_pack.h"
 #include "mavlink_tests/mavlink_ftp_test.h"
 
 #include "mavlink_main.h"
@@ -54,12 +55,14 @@ constexpr const char MavlinkFTP::_root_dir[];
 MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 	_mavlink(mavlink)
 {
-	// initialize session
-	_session_info.fd = -1;
 }
 
 MavlinkFTP::~MavlinkFTP()
 {
+	for (SessionInfo &session : _sessions) {
+		_closeSession(session);
+	}
+
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
 }
@@ -67,7 +70,7 @@ MavlinkFTP::~MavlinkFTP()
 unsigned
 MavlinkFTP::get_size()
 {
-	if (_session_info.stream_download) {
+	if (burst_active()) {
 		return MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
 
 	} else {
@@ -75,6 +78,84 @@ MavlinkFTP::get_size()
 	}
 }
 
+bool
+MavlinkFTP::burst_active() const
+{
+	for (const SessionInfo &session : _sessions) {
+		if (session.stream_download) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+MavlinkFTP::SessionInfo *
+MavlinkFTP::_getSession(uint8_t session)
+{
+	if ((session < kMaxSessions) && (_sessions[session].fd >= 0)) {
+		return &_sessions[session];
+	}
+
+	return nullptr;
+}
+
+void
+MavlinkFTP::_closeSession(SessionInfo &session)
+{
+	if (session.fd >= 0) {
+		::close(session.fd);
+	}
+
+#if !defined(CONSTRAINED_FLASH)
+
+	if (session.generated) {
+		// the work buffers might already be freed (idle timeout, destructor)
+		char path[sizeof(PX4_STORAGEDIR "/.ftp_gen-2147483648_255.tmp")];
+		_generatedPath(path, sizeof(path), (unsigned)(&session - _sessions));
+		::unlink(path);
+	}
+
+#endif // !CONSTRAINED_FLASH
+
+	delete[] session.read_ahead;
+
+	session = SessionInfo{};
+}
+
+int
+MavlinkFTP::_readSession(SessionInfo &session, uint32_t offset, uint8_t *dst, unsigned len)
+{
+	if (session.read_ahead == nullptr) {
+		return ::pread(session.fd, dst, len, offset);
+	}
+
+	const uint32_t block_end = session.read_ahead_offset + session.read_ahead_length;
+
+	// a short block ends at EOF, so it holds everything there is past its start
+	const bool cached = (offset >= session.read_ahead_offset) && (offset < block_end)
+			    && ((offset + len <= block_end) || (session.read_ahead_length < kReadAheadLength));
+
+	if (!cached) {
+		const int bytes_read = ::pread(session.fd, session.read_ahead, kReadAheadLength, offset);
+
+		if (bytes_read < 0) {
+			session.read_ahead_length = 0;
+			return bytes_read;
+		}
+
+		session.read_ahead_offset = offset;
+		session.read_ahead_length = bytes_read;
+	}
+
+	const unsigned available = session.read_ahead_offset + session.read_ahead_length - offset;
+	const unsigned bytes = (len < available) ? len : available;
+
+	memcpy(dst, &session.read_ahead[offset - session.read_ahead_offset], bytes);
+
+	return bytes;
+}
+
 #ifdef MAVLINK_FTP_UNIT_TEST
 void
 MavlinkFTP::set_unittest_worker(ReceiveMessageFunc_t rcvMsgFunc, void *worker_data)
@@ -503,11 +584,25 @@ MavlinkFTP::_workList(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 {
-	if (_session_info.fd >= 0) {
+	uint8_t session_id = 0;
+
+	while ((session_id < kMaxSessions) && (_sessions[session_id].fd >= 0)) {
+		session_id++;
+	}
+
+	if (session_id >= kMaxSessions) {
 		PX4_ERR("FTP: Open failed - out of sessions");
 		return kErrNoSessionsAvailable;
 	}
 
+#if !defined(CONSTRAINED_FLASH)
+
+	if (oflag == O_RDONLY && MavlinkParamPack::matches(_data_as_cstring(payload))) {
+		return _openParamPack(payload, session_id);
+	}
+
+#endif // !CONSTRAINED_FLASH
+
 	_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
 
 	PX4_DEBUG("FTP: open '%s'", _work_buffer1);
@@ -541,42 +636,91 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrFailErrno;
 	}
 
-	_session_info.fd = fd;
-	_session_info.file_size = fileSize;
-	_session_info.stream_download = false;
+	SessionInfo &session = _sessions[session_id];
+	session.fd = fd;
+	session.file_size = fileSize;
+	session.stream_download = false;
 
-	payload->session = 0;
+	payload->session = session_id;
 	payload->size = sizeof(uint32_t);
 	std::memcpy(payload->data, &fileSize, payload->size);
 
 	return kErrNone;
 }
 
+#if !defined(CONSTRAINED_FLASH)
+void MavlinkFTP::_generatedPath(char *dst, int dst_len, unsigned session_id) const
+{
+	// every MAVLink instance has its own MavlinkFTP, they must not share a file for the same session slot
+	snprintf(dst, dst_len, PX4_STORAGEDIR "/.ftp_gen%d_%u.tmp", _mavlink.get_instance_id(), session_id);
+}
+
+/// @brief Generates the packed parameter file for a session and opens it for reading
+MavlinkFTP::ErrorCode
+MavlinkFTP::_openParamPack(PayloadHeader *payload, uint8_t session_id)
+{
+	_generatedPath(_work_buffer1, _work_buffer1_len, session_id);
+
+	int fd = ::open(_work_buffer1, O_CREAT | O_TRUNC | O_RDWR, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		_our_errno = errno;
+		PX4_ERR("open failed: %s", strerror(_our_errno));
+		return kErrFailErrno;
+	}
+
+	SessionInfo &session = _sessions[session_id];
+	session.fd = fd;
+
+#if defined(__PX4_POSIX)
+	// the open descriptor keeps the file alive, nothing left to clean up on close
+	::unlink(_work_buffer1);
+#else
+	session.generated = true;
+#endif
+
+	const int ret = MavlinkParamPack::write(fd, _data_as_cstring(payload));
+	struct stat st;
+
+	if (ret < 0 || fstat(fd, &st) != 0) {
+		_our_errno = (ret < 0) ? -ret : errno;
+		PX4_ERR("param pack failed: %s", strerror(_our_errno));
+		_closeSession(session);
+		return kErrFailErrno;
+	}
+
+	PX4_DEBUG("FTP: packed %d params", ret);
+
+	uint32_t fileSize = st.st_size;
+	session.file_size = fileSize;
+
+	payload->session = session_id;
+	payload->size = sizeof(uint32_t);
+	std::memcpy(payload->data, &fileSize, payload->size);
+
+	return kErrNone;
+}
+#endif // !CONSTRAINED_FLASH
+
 /// @brief Responds to a Read command
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workRead(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("FTP: read offset:%ld" PRIu32, payload->offset);
 
-	// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-	if (payload->offset >= _session_info.file_size) {
+	// We have to test reads past EOF ourselves, pread returns 0 bytes
+	if (payload->offset >= session->file_size) {
 		PX4_WARN("request past EOF");
 		return kErrEOF;
 	}
 
-	PX4_DEBUG("lseek with offset: %ld", payload->offset);
-
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-		_our_errno = errno;
-		PX4_ERR("seek fail: %s", strerror(_our_errno));
-		return kErrFailErrno;
-	}
-
-	int bytes_read = ::read(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_read = _readSession(*session, payload->offset, &payload->data[0], payload->size);
 
 	if (bytes_read < 0) {
 		// Negative return indicates error other than eof
@@ -594,19 +738,28 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workBurst: no session or no fd");
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
+
+	// read the file in larger blocks while streaming, fall back to plain reads if the allocation fails
+	if (session->read_ahead == nullptr) {
+		session->read_ahead = new uint8_t[kReadAheadLength];
+		session->read_ahead_length = 0;
+	}
+
 	// Setup for streaming sends
-	_session_info.stream_download = true;
-	_session_info.stream_offset = payload->offset;
-	_session_info.stream_chunk_transmitted = 0;
-	_session_info.stream_seq_number = payload->seq_number + 1;
-	_session_info.stream_target_system_id = target_system_id;
-	_session_info.stream_target_component_id = target_component_id;
+	session->stream_download = true;
+	session->stream_offset = payload->offset;
+	session->stream_chunk_transmitted = 0;
+	session->stream_seq_number = payload->seq_number + 1;
+	session->stream_target_system_id = target_system_id;
+	session->stream_target_component_id = target_component_id;
 
 	return kErrNone;
 }
@@ -615,7 +768,9 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workWrite(PayloadHeader *payload)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workWrite: no session or no fd");
 		return kErrInvalidSession;
 	}
@@ -624,14 +779,8 @@ MavlinkFTP::_workWrite(PayloadHeader *payload)
 		return kErrFailFileProtected;
 	}
 
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-		// Unable to see to the specified location
-		PX4_ERR("seek fail");
-		return kErrFailErrno;
-	}
-
 	PX4_DEBUG("write %d bytes", payload->size);
-	int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_written = ::pwrite(session->fd, &payload->data[0], payload->size, payload->offset);
 
 	if (bytes_written < 0) {
 		// Negative return indicates error other than eof
@@ -790,14 +939,14 @@ MavlinkFTP::_workTruncateFile(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workTerminate(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("work terminate: close");
-	::close(_session_info.fd);
-	_session_info.fd = -1;
-	_session_info.stream_download = false;
+	_closeSession(*session);
 
 	payload->size = 0;
 
@@ -810,10 +959,8 @@ MavlinkFTP::_workReset(PayloadHeader *payload)
 {
 	PX4_DEBUG("work reset: close");
 
-	if (_session_info.fd != -1) {
-		::close(_session_info.fd);
-		_session_info.fd = -1;
-		_session_info.stream_download = false;
+	for (SessionInfo &session : _sessions) {
+		_closeSession(session);
 	}
 
 	payload->size = 0;
@@ -1027,21 +1174,32 @@ void MavlinkFTP::send()
 			}
 		}
 
-	} else if (_session_info.fd != -1) {
-		// close session without activity
-		if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
-			::close(_session_info.fd);
-			_session_info.fd = -1;
-			_session_info.stream_download = false;
-			_last_reply_valid = false;
-			PX4_WARN("Session was closed without activity");
+	} else if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
+		// close sessions without activity
+		for (SessionInfo &session : _sessions) {
+			if (session.fd != -1) {
+				_closeSession(session);
+				_last_reply_valid = false;
+				PX4_WARN("Session was closed without activity");
+			}
 		}
 	}
 
-	// Anything to stream?
-	if (!_session_info.stream_download) {
-		return;
+	// serve streaming sessions in turn
+	for (uint8_t i = 0; i < kMaxSessions; i++) {
+		const uint8_t session_id = (_stream_next_session + i) % kMaxSessions;
+
+		if (_sessions[session_id].stream_download) {
+			_stream_next_session = (session_id + 1) % kMaxSessions;
+			_sendBurst(session_id);
+			return;
+		}
 	}
+}
+
+void MavlinkFTP::_sendBurst(uint8_t session_id)
+{
+	SessionInfo &session = _sessions[session_id];
 
 #ifndef MAVLINK_FTP_UNIT_TEST
 	// Skip send if not enough room
@@ -1066,30 +1224,23 @@ void MavlinkFTP::send()
 		mavlink_file_transfer_protocol_t ftp_msg;
 		PayloadHeader *payload = reinterpret_cast<PayloadHeader *>(&ftp_msg.payload[0]);
 
-		payload->seq_number = _session_info.stream_seq_number;
-		payload->session = 0;
+		payload->seq_number = session.stream_seq_number;
+		payload->session = session_id;
 		payload->opcode = kRspAck;
 		payload->req_opcode = kCmdBurstReadFile;
-		payload->offset = _session_info.stream_offset;
-		_session_info.stream_seq_number++;
+		payload->offset = session.stream_offset;
+		session.stream_seq_number++;
 
-		PX4_DEBUG("stream send: offset %" PRIu32, _session_info.stream_offset);
+		PX4_DEBUG("stream send: offset %" PRIu32, session.stream_offset);
 
-		// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-		if (_session_info.stream_offset >= _session_info.file_size) {
+		// We have to test reads past EOF ourselves, pread returns 0 bytes
+		if (session.stream_offset >= session.file_size) {
 			error_code = kErrEOF;
 			PX4_DEBUG("stream download: sending Nak EOF");
 		}
 
 		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
-		}
-
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+			int bytes_read = _readSession(session, payload->offset, &payload->data[0], kMaxDataLength);
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1098,8 +1249,8 @@ void MavlinkFTP::send()
 
 			} else {
 				payload->size = bytes_read;
-				_session_info.stream_offset += bytes_read;
-				_session_info.stream_chunk_transmitted += bytes_read;
+				session.stream_offset += bytes_read;
+				session.stream_chunk_transmitted += bytes_read;
 			}
 		}
 
@@ -1114,7 +1265,7 @@ void MavlinkFTP::send()
 				payload->data[1] = _our_errno;
 			}
 
-			_session_info.stream_download = false;
+			session.stream_download = false;
 
 		} else {
 #ifndef MAVLINK_FTP_UNIT_TEST
@@ -1123,10 +1274,10 @@ void MavlinkFTP::send()
 				more_data = false;
 
 				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				if (session.stream_chunk_transmitted > kBurstLength) {
 					payload->burst_complete = true;
-					_session_info.stream_download = false;
-					_session_info.stream_chunk_transmitted = 0;
+					session.stream_download = false;
+					session.stream_chunk_transmitted = 0;
 				}
 
 			} else {
@@ -1140,9 +1291,9 @@ void MavlinkFTP::send()
 #endif
 		}
 
-		ftp_msg.target_system = _session_info.stream_target_system_id;
+		ftp_msg.target_system = session.stream_target_system_id;
 		ftp_msg.target_network = 0;
-		ftp_msg.target_component = _session_info.stream_target_component_id;
+		ftp_msg.target_component = session.stream_target_component_id;
 		_reply(&ftp_msg);
 	} while (more_data);
 }
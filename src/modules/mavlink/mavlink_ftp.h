@@ -64,6 +64,16 @@ public:
 	/// Handle possible FTP message
 	void handle_message(const mavlink_message_t *msg);
 
+	/// @return true if a burst download is in progress on any session
+	bool burst_active() const;
+
+	/// @brief Maximum number of concurrently open sessions
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr uint8_t kMaxSessions = 1;
+#else
+	static constexpr uint8_t kMaxSessions = 3;
+#endif
+
 	typedef void (*ReceiveMessageFunc_t)(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data);
 
 	/// @brief Sets up the server to run in unit test mode.
@@ -147,6 +157,25 @@ private:
 	ErrorCode	_workRename(PayloadHeader *payload);
 	ErrorCode	_workCalcFileCRC32(PayloadHeader *payload);
 
+	struct SessionInfo;
+
+	/// @return open session for the session id of a request, nullptr if invalid
+	SessionInfo	*_getSession(uint8_t session);
+	void		_closeSession(SessionInfo &session);
+
+	/// @brief Reads file data of a session, served from the read-ahead block if there is one
+	/// @return number of bytes read, 0 at EOF, negative on error
+	int		_readSession(SessionInfo &session, uint32_t offset, uint8_t *dst, unsigned len);
+
+#if !defined(CONSTRAINED_FLASH)
+	/// @brief Path of the file generated for virtual files like the packed parameters
+	void		_generatedPath(char *dst, int dst_len, unsigned session_id) const;
+	ErrorCode	_openParamPack(PayloadHeader *payload, uint8_t session_id);
+#endif // !CONSTRAINED_FLASH
+
+	/// @brief Sends the next burst packets of a streaming session
+	void		_sendBurst(uint8_t session_id);
+
 	uint8_t _getServerSystemId(void);
 	uint8_t _getServerComponentId(void);
 	uint8_t _getServerChannel(void);
@@ -171,17 +200,28 @@ private:
 	/// @brief Maximum data size in RequestHeader::data
 	static const uint8_t	kMaxDataLength = MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN - sizeof(PayloadHeader);
 
+	/// @brief Size of the file block read at once for burst downloads
+	static constexpr unsigned kReadAheadLength = 4 * kMaxDataLength;
+
+	/// @brief Bytes sent in one burst before the client has to request the next one, determined empirically
+	static constexpr unsigned kBurstLength = 35000;
+
 	struct SessionInfo {
-		int		fd;
-		uint32_t	file_size;
-		bool		stream_download;
-		uint32_t	stream_offset;
-		uint16_t	stream_seq_number;
-		uint8_t		stream_target_system_id;
-		uint8_t         stream_target_component_id;
-		unsigned	stream_chunk_transmitted;
+		int		fd{-1};
+		uint32_t	file_size{0};
+		bool		stream_download{false};
+		uint32_t	stream_offset{0};
+		uint16_t	stream_seq_number{0};
+		uint8_t		stream_target_system_id{0};
+		uint8_t         stream_target_component_id{0};
+		unsigned	stream_chunk_transmitted{0};
+		uint8_t		*read_ahead{nullptr};	///< read-ahead block, allocated for burst downloads
+		uint32_t	read_ahead_offset{0};
+		unsigned	read_ahead_length{0};
+		bool		generated{false};	///< file was generated on open and is removed on close
 	};
-	struct SessionInfo _session_info {};	///< Session info, fd=-1 for no active session
+	SessionInfo _sessions[kMaxSessions] {};	///< Session info, fd=-1 for no active session
+	uint8_t _stream_next_session{0};	///< session to serve first on the next send(), for round robin
 
 	ReceiveMessageFunc_t	_utRcvMsgFunc{};	///< Unit test override for mavlink message sending
 	void			*_worker_data{nullptr};	///< Additional parameter to _utRcvMsgFunc;
@@ -703,14 +703,18 @@ Mavlink::get_free_tx_buf()
 	 */
 	int buf_free = 0;
 
+	// only a buffer space reported by the device has to make room for the pending batch,
+	// the fixed estimates below are per write and the batch goes out in a single write
+	bool device_space = false;
+
 #if defined(MAVLINK_UDP)
 
 	// if we are using network sockets, return max length of one packet
 	if (get_protocol() == Protocol::UDP) {
 # if defined(__PX4_POSIX)
-		return  1500 * 10; // Speed up FTP transfers
+		buf_free = 1500 * 10; // Speed up FTP transfers
 # else
-		return  1500;
+		buf_free = 1500;
 # endif /* defined(__PX4_POSIX) */
 
 	} else
@@ -719,6 +723,7 @@ Mavlink::get_free_tx_buf()
 
 #if defined(__PX4_NUTTX)
 		(void) ioctl(_uart_fd, FIONSPACE, (unsigned long)&buf_free);
+		device_space = true;
 #else
 		// No FIONSPACE on Linux todo:use SIOCOUTQ  and queue size to emulate FIONSPACE
 		//Linux cp210x does not support TIOCOUTQ
@@ -739,7 +744,12 @@ Mavlink::get_free_tx_buf()
 		}
 	}
 
-	return buf_free;
+	if (!device_space) {
+		return buf_free;
+	}
+
+	// packets waiting in the transmit batch still need to go through the buffer
+	return (buf_free > (int)_tx_batch_fill) ? (buf_free - _tx_batch_fill) : 0;
 }
 
 void Mavlink::send_start(int length)
@@ -747,8 +757,21 @@ void Mavlink::send_start(int length)
 	pthread_mutex_lock(&_send_mutex);
 	_last_write_try_time = hrt_absolute_time();
 
+	// write out the batch first if the packet does not fit anymore
+	if (_tx_batch_fill + length > sizeof(_tx_batch)) {
+		flush_tx_locked();
+	}
+
+	int buf_free = get_free_tx_buf();
+
+	// the pending batch might be what fills the buffer, write it out and check again
+	if ((length > buf_free) && (_tx_batch_fill > 0)) {
+		flush_tx_locked();
+		buf_free = get_free_tx_buf();
+	}
+
 	// check if there is space in the buffer
-	if (length > (int)get_free_tx_buf()) {
+	if (length > buf_free) {
 		// not enough space in buffer to send
 		count_txerrbytes(length);
 
@@ -764,16 +787,53 @@ void Mavlink::send_start(int length)
 
 void Mavlink::send_finish()
 {
-	if (_tx_buffer_low || (_buf_fill == 0)) {
-		pthread_mutex_unlock(&_send_mutex);
+	if (!_tx_buffer_low && (_buf_fill > 0)) {
+		_tx_batch_fill += _buf_fill;
+		_tx_batch_packets++;
+
+		// the Iridium modem driver expects one message per write
+		if (_mode == MAVLINK_MODE_IRIDIUM) {
+			flush_tx_locked();
+		}
+	}
+
+	_buf_fill = 0;
+
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
+{
+	if (!_tx_buffer_low) {
+		if (_tx_batch_fill + _buf_fill + packet_len <= sizeof(_tx_batch)) {
+			memcpy(&_tx_batch[_tx_batch_fill + _buf_fill], buf, packet_len);
+			_buf_fill += packet_len;
+
+		} else {
+			perf_count(_send_byte_error_perf);
+		}
+	}
+}
+
+void Mavlink::flush_tx()
+{
+	pthread_mutex_lock(&_send_mutex);
+	flush_tx_locked();
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::flush_tx_locked()
+{
+	if (_tx_batch_fill == 0) {
 		return;
 	}
 
 	int ret = -1;
 
-	// send message to UART
+	// send batch to UART
 	if (get_protocol() == Protocol::SERIAL) {
-		ret = ::write(_uart_fd, _buf, _buf_fill);
+		ret = ::write(_uart_fd, _tx_batch, _tx_batch_fill);
+		_tx_syscalls++;
 	}
 
 #if defined(MAVLINK_UDP)
@@ -784,7 +844,8 @@ void Mavlink::send_finish()
 
 		if (_src_addr_initialized) {
 # endif // CONFIG_NET
-			ret = sendto(_socket_fd, _buf, _buf_fill, 0, (struct sockaddr *)&_src_addr, sizeof(_src_addr));
+			ret = sendto(_socket_fd, _tx_batch, _tx_batch_fill, 0, (struct sockaddr *)&_src_addr, sizeof(_src_addr));
+			_tx_syscalls++;
 # if defined(CONFIG_NET)
 		}
 
@@ -797,9 +858,10 @@ void Mavlink::send_finish()
 				find_broadcast_address();
 			}
 
-			if (_broadcast_address_found && _buf_fill > 0) {
+			if (_broadcast_address_found) {
 
-				int bret = sendto(_socket_fd, _buf, _buf_fill, 0, (struct sockaddr *)&_bcast_addr, sizeof(_bcast_addr));
+				int bret = sendto(_socket_fd, _tx_batch, _tx_batch_fill, 0, (struct sockaddr *)&_bcast_addr, sizeof(_bcast_addr));
+				_tx_syscalls++;
 
 				if (bret <= 0) {
 					if (!_broadcast_failed_warned) {
@@ -816,31 +878,18 @@ void Mavlink::send_finish()
 
 #endif // MAVLINK_UDP
 
-	if (ret == (int)_buf_fill) {
-		_tstatus.tx_message_count++;
-		count_txbytes(_buf_fill);
+	if (ret == (int)_tx_batch_fill) {
+		_tstatus.tx_message_count += _tx_batch_packets;
+		count_txbytes(_tx_batch_fill);
+		_tx_syscall_bytes += _tx_batch_fill;
 		_last_write_success_time = _last_write_try_time;
 
 	} else {
-		count_txerrbytes(_buf_fill);
+		count_txerrbytes(_tx_batch_fill);
 	}
 
-	_buf_fill = 0;
-
-	pthread_mutex_unlock(&_send_mutex);
-}
-
-void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
-{
-	if (!_tx_buffer_low) {
-		if (_buf_fill + packet_len < sizeof(_buf)) {
-			memcpy(&_buf[_buf_fill], buf, packet_len);
-			_buf_fill += packet_len;
-
-		} else {
-			perf_count(_send_byte_error_perf);
-		}
-	}
+	_tx_batch_fill = 0;
+	_tx_batch_packets = 0;
 }
 
 #ifdef MAVLINK_UDP
@@ -1186,6 +1235,7 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 			} else {
 				/* delete stream */
 				_streams.deleteNode(stream);
+				_stream_scheduler.invalidate();
 				return OK; // must finish with loop after node is deleted
 			}
 
@@ -1200,6 +1250,7 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 	if (stream != nullptr) {
 		stream->set_interval(interval);
 		_streams.add(stream);
+		_stream_scheduler.invalidate();
 
 		return OK;
 	}
@@ -2389,6 +2440,7 @@ Mavlink::task_main(int argc, char *argv[])
 			handleStatus();
 			handleCommands();
 			handleAndGetCurrentCommandAck();
+			flush_tx();
 			continue;
 		}
 
@@ -2418,9 +2470,20 @@ Mavlink::task_main(int argc, char *argv[])
 
 		check_requested_subscriptions();
 
-		/* update streams */
-		for (const auto &stream : _streams) {
+		/* update streams that are due */
+		const hrt_abstime streams_start = hrt_absolute_time();
+
+		if (_stream_scheduler.rebuild_required(_rate_mult)) {
+			_stream_scheduler.rebuild(_streams, t, _rate_mult);
+		}
+
+		unsigned streams_dispatched = 0;
+		MavlinkStream *stream = nullptr;
+
+		while ((stream = _stream_scheduler.pop_due(t)) != nullptr) {
 			stream->update(t);
+			_stream_scheduler.push(stream, t);
+			streams_dispatched++;
 
 			if (!_first_heartbeat_sent) {
 				if (_mode == MAVLINK_MODE_IRIDIUM) {
@@ -2436,6 +2499,8 @@ Mavlink::task_main(int argc, char *argv[])
 			}
 		}
 
+		_stream_scheduler.record_loop(streams_dispatched, hrt_elapsed_time(&streams_start));
+
 		/* check for ulog streaming messages */
 		if (_mavlink_ulog) {
 			const int ret = _mavlink_ulog->handle_update(get_channel());
@@ -2506,9 +2571,14 @@ Mavlink::task_main(int argc, char *argv[])
 				_tstatus.tx_error_rate_avg = _bytes_txerr / dt;
 				_tstatus.rx_rate_avg = _bytes_rx / dt;
 
+				_tx_syscall_rate = _tx_syscalls / dt;
+				_tx_bytes_per_syscall = (_tx_syscalls > 0) ? (float)_tx_syscall_bytes / _tx_syscalls : 0.f;
+
 				_bytes_tx = 0;
 				_bytes_txerr = 0;
 				_bytes_rx = 0;
+				_tx_syscalls = 0;
+				_tx_syscall_bytes = 0;
 			}
 
 			_bytes_timestamp = t;
@@ -2519,11 +2589,15 @@ Mavlink::task_main(int argc, char *argv[])
 			publish_telemetry_status();
 		}
 
+		flush_tx();
+
 		perf_end(_loop_perf);
 	}
 
 	_receiver.stop();
 
+	flush_tx();
+
 	delete _subscribe_to_stream;
 	_subscribe_to_stream = nullptr;
 
@@ -3050,9 +3124,12 @@ Mavlink::display_status()
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
 	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
 	printf("\t  tx rate max: %i B/s\n", _datarate);
+	printf("\t  tx syscalls: %.1f 1/s (%.1f B each)\n", (double)_tx_syscall_rate, (double)_tx_bytes_per_syscall);
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
 	printf("\t  rx loss: %.1f%%\n", (double)_tstatus.rx_message_lost_rate);
 
+	_stream_scheduler.print_status();
+
 #if !defined(CONSTRAINED_FLASH)
 	_receiver.print_detailed_rx_stats();
 #endif // !CONSTRAINED_FLASH
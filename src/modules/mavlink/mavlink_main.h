@@ -84,6 +84,7 @@
 #include "mavlink_messages.h"
 #include "mavlink_receiver.h"
 #include "mavlink_shell.h"
+#include "mavlink_stream_scheduler.h"
 #include "mavlink_ulog.h"
 
 #define DEFAULT_BAUD_RATE       57600
@@ -308,10 +309,15 @@ public:
 	void			send_bytes(const uint8_t *buf, unsigned packet_len);
 
 	/**
-	 * Flush the transmit buffer and send one MAVLink packet
+	 * Finish one MAVLink packet and append it to the transmit batch
 	 */
 	void             	send_finish();
 
+	/**
+	 * Write out all packets in the transmit batch
+	 */
+	void			flush_tx();
+
 	/**
 	 * Resend message as is, don't change sequence number and CRC.
 	 */
@@ -447,6 +453,11 @@ public:
 
 	unsigned		get_main_loop_delay() const { return _main_loop_delay; }
 
+	/**
+	 * Reschedule all streams on the next iteration, e.g. after a stream interval changed
+	 */
+	void			invalidate_stream_schedule() { _stream_scheduler.invalidate(); }
+
 	/** get the Mavlink shell. Create a new one if there isn't one. It is *always* created via MavlinkReceiver thread.
 	 *  Returns nullptr if shell cannot be created */
 	MavlinkShell		*get_shell();
@@ -456,11 +467,13 @@ public:
 
 	/** get ulog streaming if active, nullptr otherwise */
 	MavlinkULog		*get_ulog_streaming() { return _mavlink_ulog; }
+	static constexpr float ULOG_STREAMING_RATE_FACTOR{0.7f}; ///< share of the link data rate ulog streaming may use
+
 	void			try_start_ulog_streaming(uint8_t target_system, uint8_t target_component)
 	{
 		if (_mavlink_ulog) { return; }
 
-		_mavlink_ulog = MavlinkULog::try_start(_datarate, 0.7f, target_system, target_component);
+		_mavlink_ulog = MavlinkULog::try_start(_datarate, ULOG_STREAMING_RATE_FACTOR, target_system, target_component);
 	}
 
 	const events::SendProtocol &get_events_protocol() const { return _events; };
@@ -536,6 +549,7 @@ private:
 	unsigned		_main_loop_delay{1000};	/**< mainloop delay, depends on data rate */
 
 	List<MavlinkStream *>		_streams;
+	MavlinkStreamScheduler		_stream_scheduler;
 
 	MavlinkShell		*_mavlink_shell{nullptr};
 	pthread_mutex_t		_mavlink_shell_mutex{};
@@ -601,8 +615,22 @@ private:
 	unsigned short		_remote_port{DEFAULT_REMOTE_PORT_UDP};
 #endif // MAVLINK_UDP
 
-	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
-	unsigned		_buf_fill{0};
+	/* write combining buffer, packets are coalesced and written out once per loop or when full */
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr unsigned MAVLINK_TX_BATCH_SIZE{MAVLINK_MAX_PACKET_LEN};
+#else
+	static constexpr unsigned MAVLINK_TX_BATCH_SIZE{1472}; // one Ethernet MTU sized UDP datagram
+#endif
+
+	uint8_t			_tx_batch[MAVLINK_TX_BATCH_SIZE] {};
+	unsigned		_tx_batch_fill{0};	///< bytes of completed packets in the batch
+	unsigned		_tx_batch_packets{0};	///< number of completed packets in the batch
+	unsigned		_buf_fill{0};		///< bytes of the packet currently being written
+
+	unsigned		_tx_syscalls{0};
+	unsigned		_tx_syscall_bytes{0};
+	float			_tx_syscall_rate{0.f};
+	float			_tx_bytes_per_syscall{0.f};
 
 	bool			_tx_buffer_low{false};
 
@@ -663,6 +691,11 @@ private:
 	 */
 	int configure_stream(const char *stream_name, const float rate = -1.0f);
 
+	/**
+	 * Write out the transmit batch, must be called with _send_mutex held
+	 */
+	void flush_tx_locked();
+
 	/**
 	 * Configure default streams according to _mode for either all streams or only a single
 	 * stream.
@@ -0,0 +1,221 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_param_pack.cpp
+ * Packed parameter file for cached and incremental parameter synchronization over FTP.
+ */
+
+#include "mavlink_param_pack.h"
+#include "mavlink_bridge_header.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <parameters/param.h>
+#include <px4_platform_common/defines.h>
+
+constexpr char MavlinkParamPack::kPath[];
+
+namespace
+{
+
+/// parameter states handed out during this boot, accepted as base for incremental downloads
+struct ServedState {
+	uint32_t generation;
+	uint32_t hash;
+};
+
+constexpr int kServedHistory = 4;
+
+pthread_mutex_t served_mutex = PTHREAD_MUTEX_INITIALIZER;
+ServedState served[kServedHistory] {};
+int served_count = 0;
+int served_next = 0;
+
+bool served_contains(uint32_t generation, uint32_t hash)
+{
+	for (int i = 0; i < served_count; i++) {
+		if (served[i].generation == generation && served[i].hash == hash) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Parse the "?since=<generation>,<hash>" query of a request path.
+ * @return true if the path carries a valid query
+ */
+bool parse_since(const char *path, uint32_t &generation, uint32_t &hash)
+{
+	const char *query = strchr(path, '?');
+
+	if (query == nullptr || strncmp(query + 1, "since=", 6) != 0) {
+		return false;
+	}
+
+	char *end = nullptr;
+	generation = strtoul(query + 7, &end, 0);
+
+	if (end == query + 7 || *end != ',') {
+		return false;
+	}
+
+	const char *hash_str = end + 1;
+	hash = strtoul(hash_str, &end, 0);
+
+	return end != hash_str && *end == '\0';
+}
+
+} // namespace
+
+bool
+MavlinkParamPack::matches(const char *path)
+{
+	// tolerate a leading '/'
+	if (path[0] == '/') {
+		path++;
+	}
+
+	const size_t len = strlen(kPath);
+
+	return strncmp(path, kPath, len) == 0 && (path[len] == '\0' || path[len] == '?');
+}
+
+int
+MavlinkParamPack::write(int fd, const char *path)
+{
+	// read the generation first: parameters changing while the file is written are then at
+	// worst sent again with the next incremental download
+	const uint32_t generation = param_generation();
+	const uint32_t hash = param_hash_check();
+
+	uint32_t since_generation = 0;
+	uint32_t since_hash = 0;
+	bool delta = false;
+
+	pthread_mutex_lock(&served_mutex);
+
+	if (parse_since(path, since_generation, since_hash)) {
+		if (since_hash == hash) {
+			// client is up to date (possibly from a previous boot)
+			delta = true;
+			since_generation = generation;
+
+		} else {
+			delta = served_contains(since_generation, since_hash);
+		}
+	}
+
+	if (!served_contains(generation, hash)) {
+		served[served_next] = ServedState{generation, hash};
+		served_next = (served_next + 1) % kServedHistory;
+
+		if (served_count < kServedHistory) {
+			served_count++;
+		}
+	}
+
+	pthread_mutex_unlock(&served_mutex);
+
+	Header header{};
+	header.magic = kMagic;
+	header.version = kVersion;
+	header.flags = delta ? kFlagDelta : 0;
+	header.total = param_count_used();
+	header.generation = generation;
+	header.hash = hash;
+
+	if (::write(fd, &header, sizeof(header)) != sizeof(header)) {
+		return -errno;
+	}
+
+	// entries are collected into a buffer to keep the number of writes low
+	uint8_t buffer[256];
+	unsigned fill = 0;
+	uint16_t count = 0;
+
+	for (param_t param = 0; param < param_count(); param++) {
+		if (!param_used(param) || (delta && param_get_generation(param) <= since_generation)) {
+			continue;
+		}
+
+		const char *name = param_name(param);
+		const size_t name_len = strnlen(name, MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN);
+		const size_t entry_len = 2 + name_len + 4;
+
+		if (fill + entry_len > sizeof(buffer)) {
+			if (::write(fd, buffer, fill) != (ssize_t)fill) {
+				return -errno;
+			}
+
+			fill = 0;
+		}
+
+		const bool is_float = (param_type(param) == PARAM_TYPE_FLOAT);
+
+		union {
+			int32_t i;
+			float f;
+		} value;
+
+		if ((is_float ? param_get(param, &value.f) : param_get(param, &value.i)) != PX4_OK) {
+			continue;
+		}
+
+		buffer[fill++] = is_float ? MAV_PARAM_TYPE_REAL32 : MAV_PARAM_TYPE_INT32;
+		buffer[fill++] = name_len;
+		memcpy(&buffer[fill], name, name_len);
+		fill += name_len;
+		memcpy(&buffer[fill], &value, sizeof(value));
+		fill += sizeof(value);
+		count++;
+	}
+
+	if (fill > 0 && ::write(fd, buffer, fill) != (ssize_t)fill) {
+		return -errno;
+	}
+
+	// patch in the number of entries
+	if (::pwrite(fd, &count, sizeof(count), offsetof(Header, count)) != sizeof(count)) {
+		return -errno;
+	}
+
+	return count;
+}
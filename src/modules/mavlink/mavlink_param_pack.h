@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_param_pack.h
+ * Packed parameter file for cached and incremental parameter synchronization over FTP.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Writes the used parameters into a compact binary file that a ground station downloads
+ * via MAVLink FTP (path "@PARAM/param.pck") instead of streaming PARAM_VALUE messages.
+ *
+ * A client that already holds a copy can append "?since=<generation>,<hash>" with the
+ * values from the header of its last download. The file then only contains the parameters
+ * changed since, if the vehicle can vouch for that state: either the hash matches the current
+ * parameters, or the (generation, hash) pair was handed out earlier during this boot.
+ * Otherwise all parameters are sent and the delta flag is cleared.
+ *
+ * File layout (little endian):
+ *  Header, followed by Header::count entries of
+ *  uint8_t type (MAV_PARAM_TYPE), uint8_t name_len, char name[name_len], uint8_t value[4]
+ */
+class MavlinkParamPack
+{
+public:
+	static constexpr char kPath[] = "@PARAM/param.pck";
+
+	static constexpr uint16_t kMagic = 0x5850;
+	static constexpr uint8_t kVersion = 1;
+	static constexpr uint8_t kFlagDelta = 1 << 0;	///< only parameters changed since the requested state
+
+	struct __attribute__((packed)) Header {
+		uint16_t magic;
+		uint8_t version;
+		uint8_t flags;
+		uint16_t count;		///< number of entries in this file
+		uint16_t total;		///< number of used parameters on the vehicle
+		uint32_t generation;	///< pass back in "since" for the next incremental sync
+		uint32_t hash;		///< parameter hash (same as _HASH_CHECK)
+	};
+
+	/**
+	 * @return true if an FTP path refers to the packed parameter file
+	 */
+	static bool matches(const char *path);
+
+	/**
+	 * Write the packed parameters requested by an FTP path to a file.
+	 * @param fd open file, written from the current position
+	 * @param path requested FTP path, including any "since" query
+	 * @return number of entries written, negative errno on failure
+	 */
+	static int write(int fd, const char *path);
+};
@@ -141,6 +141,20 @@ PARAM_DEFINE_INT32(MAV_HASH_CHK_EN, 1);
  */
 PARAM_DEFINE_INT32(MAV_HB_FORW_EN, 1);
 
+/**
+ * MAVLink signing enforcement.
+ *
+ * When enabled, incoming messages without a valid MAVLink 2 signature are dropped
+ * (except RADIO_STATUS). Enforcement only starts once a signing key has been set up
+ * with SETUP_SIGNING, which is only accepted over USB.
+ *
+ * @value 0 Disabled
+ * @value 1 Enabled on all links except USB
+ * @value 2 Enabled on all links
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_SIGN_CFG, 0);
+
 /**
  * Timeout in seconds for the RADIO_STATUS reports coming in
  *
@@ -57,6 +57,11 @@
 #include <termios.h>
 #endif
 
+#if defined(__PX4_NUTTX)
+#include <nuttx/arch.h>
+#include <nuttx/sched.h>
+#endif
+
 #include "mavlink_command_sender.h"
 #include "mavlink_main.h"
 #include "mavlink_receiver.h"
@@ -302,6 +307,10 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 	case MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY:
 		handle_message_debug_float_array(msg);
 		break;
+
+	case MAVLINK_MSG_ID_SETUP_SIGNING:
+		handle_message_setup_signing(msg);
+		break;
 #endif // !CONSTRAINED_FLASH
 
 	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE:
@@ -377,6 +386,83 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 
 	}
 
+	/* handle mission, parameter, ftp and log packets */
+	if (is_bulk_message(msg->msgid)) {
+		dispatch_bulk_message(msg);
+	}
+
+	/* handle packet with timesync component */
+	_mavlink_timesync.handle_message(msg);
+
+	/* handle packet with parent object */
+	_mavlink.handle_message(msg);
+}
+
+bool
+MavlinkReceiver::is_bulk_message(uint32_t msgid)
+{
+	switch (msgid) {
+	case MAVLINK_MSG_ID_MISSION_ACK:
+	case MAVLINK_MSG_ID_MISSION_SET_CURRENT:
+	case MAVLINK_MSG_ID_MISSION_REQUEST_LIST:
+	case MAVLINK_MSG_ID_MISSION_REQUEST:
+	case MAVLINK_MSG_ID_MISSION_REQUEST_INT:
+	case MAVLINK_MSG_ID_MISSION_COUNT:
+	case MAVLINK_MSG_ID_MISSION_ITEM:
+	case MAVLINK_MSG_ID_MISSION_ITEM_INT:
+	case MAVLINK_MSG_ID_MISSION_CLEAR_ALL:
+	case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
+	case MAVLINK_MSG_ID_PARAM_SET:
+	case MAVLINK_MSG_ID_PARAM_REQUEST_READ:
+	case MAVLINK_MSG_ID_PARAM_MAP_RC:
+	case MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL:
+	case MAVLINK_MSG_ID_LOG_REQUEST_LIST:
+	case MAVLINK_MSG_ID_LOG_REQUEST_DATA:
+	case MAVLINK_MSG_ID_LOG_REQUEST_END:
+	case MAVLINK_MSG_ID_LOG_ERASE:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+void
+MavlinkReceiver::dispatch_bulk_message(mavlink_message_t *msg)
+{
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+
+	if (_bulk_queue != nullptr) {
+		{
+			LockGuard lg{_bulk_queue_mutex};
+
+			if (_bulk_queue_count < BULK_QUEUE_SIZE) {
+				_bulk_queue[(_bulk_queue_head + _bulk_queue_count) % BULK_QUEUE_SIZE] = *msg;
+				_bulk_queue_count++;
+
+				if (_bulk_queue_count > _bulk_queue_peak) {
+					_bulk_queue_peak = _bulk_queue_count;
+				}
+
+			} else {
+				// the protocols retransmit on timeout
+				_bulk_queue_dropped++;
+				return;
+			}
+		}
+
+		px4_sem_post(&_bulk_worker_sem);
+		return;
+	}
+
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+
+	handle_bulk_message(msg);
+}
+
+void
+MavlinkReceiver::handle_bulk_message(mavlink_message_t *msg)
+{
 	/* handle packet with mission manager */
 	_mission_manager.handle_message(msg);
 
@@ -399,12 +485,24 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 
 	/* handle packet with log component */
 	_mavlink_log_handler.handle_message(msg);
+}
 
-	/* handle packet with timesync component */
-	_mavlink_timesync.handle_message(msg);
+void
+MavlinkReceiver::update_bulk_protocols()
+{
+	_mission_manager.check_active_mission();
+	_mission_manager.send();
 
-	/* handle packet with parent object */
-	_mavlink.handle_message(msg);
+	if (_mavlink.get_mode() != Mavlink::MAVLINK_MODE::MAVLINK_MODE_IRIDIUM) {
+		_parameters_manager.send();
+		_mavlink.set_sending_parameters(_parameters_manager.send_active());
+	}
+
+	if (_mavlink.ftp_enabled()) {
+		_mavlink_ftp.send();
+	}
+
+	_mavlink_log_handler.send();
 }
 
 void MavlinkReceiver::handle_messages_in_gimbal_mode(mavlink_message_t &msg)
@@ -724,16 +822,22 @@ void MavlinkReceiver::handle_message_command_both(mavlink_message_t *msg, const
 			return;
 		}
 
+		vehicle_command_s command_forward{vehicle_command};
+
 		if (cmd_mavlink.command == MAV_CMD_LOGGING_START) {
 			// check that we have enough bandwidth available: this is given by the configured logger topics
 			// and rates. The 5000 is somewhat arbitrary, but makes sure that we cannot enable log streaming
-			// on a radio link
-			if (_mavlink.get_data_rate() < 5000) {
+			// on a radio link. Compressed streaming shapes the topic rates to the link, so it only needs
+			// enough bandwidth for a useful set of topics.
+			const bool compressed = ((int)(cmd_mavlink.param1 + 0.5f) == ulog_stream_s::FORMAT_ULOG_COMPRESSED);
+			const int min_data_rate = compressed ? 2000 : 5000;
+
+			if (_mavlink.get_data_rate() < min_data_rate) {
 				send_ack = true;
 				result = vehicle_command_ack_s::VEHICLE_CMD_RESULT_DENIED;
 				_mavlink.send_statustext_critical("Not enough bandwidth to enable log streaming\t");
-				events::send<uint32_t>(events::ID("mavlink_log_not_enough_bw"), events::Log::Error,
-						       "Not enough bandwidth to enable log streaming ({1} \\< 5000)", _mavlink.get_data_rate());
+				events::send<uint32_t, uint32_t>(events::ID("mavlink_log_not_enough_bw"), events::Log::Error,
+								 "Not enough bandwidth to enable log streaming ({1} \\< {2})", _mavlink.get_data_rate(), min_data_rate);
 
 			} else {
 				// we already instanciate the streaming object, because at this point we know on which
@@ -741,11 +845,16 @@ void MavlinkReceiver::handle_message_command_both(mavlink_message_t *msg, const
 				// not even running. The main mavlink thread takes care of this by waiting for an ack
 				// from the logger.
 				_mavlink.try_start_ulog_streaming(msg->sysid, msg->compid);
+
+				if (compressed && !(command_forward.param2 > 0.f)) {
+					// no target rate requested: let the logger shape the topics to what this link can carry
+					command_forward.param2 = _mavlink.get_data_rate() * Mavlink::ULOG_STREAMING_RATE_FACTOR;
+				}
 			}
 		}
 
 		if (!send_ack) {
-			_cmd_pub.publish(vehicle_command);
+			_cmd_pub.publish(command_forward);
 		}
 	}
 
@@ -2827,6 +2936,39 @@ MavlinkReceiver::handle_message_debug_float_array(mavlink_message_t *msg)
 
 	_debug_array_pub.publish(debug_topic);
 }
+
+void
+MavlinkReceiver::handle_message_setup_signing(mavlink_message_t *msg)
+{
+	mavlink_setup_signing_t setup_signing;
+	mavlink_msg_setup_signing_decode(msg, &setup_signing);
+
+	if (setup_signing.target_system != mavlink_system.sysid
+	    || (setup_signing.target_component != 0 && setup_signing.target_component != mavlink_system.compid)) {
+		return;
+	}
+
+	// the key is sent in plain text
+	if (!_mavlink.is_usb_uart()) {
+		PX4_WARN("signing key can only be set up over USB");
+		return;
+	}
+
+	if (MavlinkSignVerify::set_key(setup_signing.secret_key, setup_signing.initial_timestamp)) {
+		PX4_INFO("signing key updated");
+
+	} else {
+		PX4_ERR("storing signing key failed");
+	}
+}
+
+void
+MavlinkReceiver::update_signing()
+{
+	const int32_t sign_cfg = _param_mav_sign_cfg.get();
+	_sign_verify.set_enforced(sign_cfg == 2 || (sign_cfg == 1 && !_mavlink.is_usb_uart()));
+	_sign_verify.update_key();
+}
 #endif // !CONSTRAINED_FLASH
 
 void
@@ -3162,6 +3304,11 @@ MavlinkReceiver::run()
 	ssize_t nread = 0;
 	hrt_abstime last_send_update = 0;
 
+#if !defined(CONSTRAINED_FLASH)
+	// signatures are verified by the MAVLink library while parsing on the channel
+	_sign_verify.start(_mavlink.get_status());
+#endif // !CONSTRAINED_FLASH
+
 	while (!_should_exit.load()) {
 
 		// check for parameter updates
@@ -3174,6 +3321,10 @@ MavlinkReceiver::run()
 			updateParams();
 		}
 
+#if !defined(CONSTRAINED_FLASH)
+		update_signing();
+#endif // !CONSTRAINED_FLASH
+
 		int ret = poll(&fds[0], 1, timeout);
 
 		if (ret > 0) {
@@ -3290,25 +3441,27 @@ MavlinkReceiver::run()
 		CheckHeartbeats(t);
 
 		if (t - last_send_update > timeout * 1000) {
-			_mission_manager.check_active_mission();
-			_mission_manager.send();
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
 
-			if (_mavlink.get_mode() != Mavlink::MAVLINK_MODE::MAVLINK_MODE_IRIDIUM) {
-				_parameters_manager.send();
-				_mavlink.set_sending_parameters(_parameters_manager.send_active());
-			}
+			if (_bulk_queue != nullptr) {
+				_bulk_update_requested.store(true);
+				px4_sem_post(&_bulk_worker_sem);
 
-			if (_mavlink.ftp_enabled()) {
-				_mavlink_ftp.send();
+			} else
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+			{
+				update_bulk_protocols();
 			}
 
-			_mavlink_log_handler.send();
 			last_send_update = t;
 		}
 
 		if (_tune_publisher != nullptr) {
 			_tune_publisher->publish_next_tune(t);
 		}
+
+		// write out replies without waiting for the next transmit loop
+		_mavlink.flush_tx();
 	}
 }
 
@@ -3455,6 +3608,38 @@ void MavlinkReceiver::update_message_statistics(const mavlink_message_t &message
 
 void MavlinkReceiver::print_detailed_rx_stats() const
 {
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+
+	if (_bulk_queue != nullptr) {
+		printf("\tbulk worker queue: %u of %u (peak %u), dropped: %" PRIu32 "\n", _bulk_queue_count, BULK_QUEUE_SIZE,
+		       _bulk_queue_peak, _bulk_queue_dropped);
+
+#if defined(__PX4_NUTTX)
+		// stack high-water mark of the worker, the handlers it runs are not bounded statically
+		sched_lock();
+		FAR struct tcb_s *tcb = nxsched_get_tcb((pid_t)_bulk_worker_thread);
+		const size_t stack_free = (tcb != nullptr) ? up_check_tcbstack_remain(tcb) : 0;
+		sched_unlock();
+
+		if (tcb != nullptr) {
+			printf("\tbulk worker stack: %zu of %zu bytes free\n", stack_free,
+			       (size_t)PX4_STACK_ADJUSTED(BULK_WORKER_STACK_SIZE + MAVLINK_RECEIVER_NET_ADDED_STACK));
+		}
+
+#endif // __PX4_NUTTX
+	}
+
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+
+#if !defined(CONSTRAINED_FLASH)
+
+	if (_param_mav_sign_cfg.get() != 0) {
+		printf("\tsigning: %s, rejected: %" PRIu32 "\n", _sign_verify.active() ? "active" : "inactive",
+		       _sign_verify.rejected());
+	}
+
+#endif // !CONSTRAINED_FLASH
+
 	// TODO: add mutex around shared data.
 	if (_component_states_count > 0) {
 		printf("\tReceived Messages:\n");
@@ -3493,8 +3678,111 @@ void MavlinkReceiver::print_detailed_rx_stats() const
 	}
 }
 
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+void
+MavlinkReceiver::run_bulk_worker()
+{
+	/* set thread name */
+	{
+		char thread_name[17];
+		snprintf(thread_name, sizeof(thread_name), "mavlink_blk_if%d", _mavlink.get_instance_id());
+		px4_prctl(PR_SET_NAME, thread_name, px4_getpid());
+	}
+
+	mavlink_message_t msg;
+
+	while (!_should_exit.load()) {
+		const bool ftp_burst = _mavlink.ftp_enabled() && _mavlink_ftp.burst_active();
+
+		if (ftp_burst) {
+			// keep a running FTP burst going faster than the periodic protocol updates
+			px4_usleep(FTP_BURST_INTERVAL);
+
+			// consume the wake-ups that arrived in the meantime
+			while (px4_sem_trywait(&_bulk_worker_sem) == 0) {}
+
+		} else {
+			// woken up for every queued message and periodically by the receive thread
+			do {} while (px4_sem_wait(&_bulk_worker_sem) != 0);
+		}
+
+		while (pop_bulk_message(msg)) {
+			handle_bulk_message(&msg);
+		}
+
+		bool update_requested = true;
+
+		if (_bulk_update_requested.compare_exchange(&update_requested, false)) {
+			update_bulk_protocols();
+
+		} else if (ftp_burst) {
+			_mavlink_ftp.send();
+		}
+
+		// write out replies without waiting for the next transmit loop
+		_mavlink.flush_tx();
+	}
+}
+
+bool
+MavlinkReceiver::pop_bulk_message(mavlink_message_t &msg)
+{
+	LockGuard lg{_bulk_queue_mutex};
+
+	if (_bulk_queue_count == 0) {
+		return false;
+	}
+
+	msg = _bulk_queue[_bulk_queue_head];
+	_bulk_queue_head = (_bulk_queue_head + 1) % BULK_QUEUE_SIZE;
+	_bulk_queue_count--;
+
+	return true;
+}
+
+void *MavlinkReceiver::start_bulk_worker_trampoline(void *context)
+{
+	MavlinkReceiver *self = reinterpret_cast<MavlinkReceiver *>(context);
+	self->run_bulk_worker();
+	return nullptr;
+}
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+
 void MavlinkReceiver::start()
 {
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+	_bulk_queue = new mavlink_message_t[BULK_QUEUE_SIZE];
+
+	if (_bulk_queue != nullptr) {
+		pthread_mutex_init(&_bulk_queue_mutex, nullptr);
+		px4_sem_init(&_bulk_worker_sem, 0, 0);
+		px4_sem_setprotocol(&_bulk_worker_sem, SEM_PRIO_NONE);
+
+		pthread_attr_t worker_attr;
+		pthread_attr_init(&worker_attr);
+
+		// below the receive thread, so that bulk transfers never delay time critical messages
+		struct sched_param param;
+		(void)pthread_attr_getschedparam(&worker_attr, &param);
+		param.sched_priority = SCHED_PRIORITY_MAX - 90;
+		(void)pthread_attr_setschedparam(&worker_attr, &param);
+
+		pthread_attr_setstacksize(&worker_attr, PX4_STACK_ADJUSTED(BULK_WORKER_STACK_SIZE + MAVLINK_RECEIVER_NET_ADDED_STACK));
+
+		if (pthread_create(&_bulk_worker_thread, &worker_attr, MavlinkReceiver::start_bulk_worker_trampoline,
+				   (void *)this) != 0) {
+			PX4_ERR("bulk worker thread start failed");
+			px4_sem_destroy(&_bulk_worker_sem);
+			pthread_mutex_destroy(&_bulk_queue_mutex);
+			delete[] _bulk_queue;
+			_bulk_queue = nullptr;
+		}
+
+		pthread_attr_destroy(&worker_attr);
+	}
+
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+
 	pthread_attr_t receiveloop_attr;
 	pthread_attr_init(&receiveloop_attr);
 
@@ -3529,4 +3817,22 @@ void MavlinkReceiver::stop()
 {
 	_should_exit.store(true);
 	pthread_join(_thread, nullptr);
+
+#if !defined(CONSTRAINED_FLASH)
+	_sign_verify.stop();
+#endif // !CONSTRAINED_FLASH
+
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+
+	if (_bulk_queue != nullptr) {
+		px4_sem_post(&_bulk_worker_sem);
+		pthread_join(_bulk_worker_thread, nullptr);
+
+		px4_sem_destroy(&_bulk_worker_sem);
+		pthread_mutex_destroy(&_bulk_queue_mutex);
+		delete[] _bulk_queue;
+		_bulk_queue = nullptr;
+	}
+
+#endif // MAVLINK_RECEIVER_BULK_WORKER
 }
@@ -47,6 +47,7 @@
 #include "mavlink_log_handler.h"
 #include "mavlink_mission.h"
 #include "mavlink_parameters.h"
+#include "mavlink_sign_verify.h"
 #include "MavlinkStatustextHandler.hpp"
 #include "mavlink_timesync.h"
 #include "tune_publisher.h"
@@ -112,6 +113,8 @@
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/velocity_limits.h>
 
+#include <px4_platform_common/sem.h>
+
 #if !defined(CONSTRAINED_FLASH)
 # include <uORB/topics/debug_array.h>
 # include <uORB/topics/debug_key_value.h>
@@ -121,6 +124,11 @@
 
 using namespace time_literals;
 
+#if !defined(CONSTRAINED_MEMORY)
+/* handle bulk protocol traffic (mission, parameters, FTP, logs) on a separate worker thread */
+# define MAVLINK_RECEIVER_BULK_WORKER
+#endif
+
 class Mavlink;
 
 class MavlinkReceiver : public ModuleParams
@@ -142,6 +150,28 @@ private:
 	static void *start_trampoline(void *context);
 	void run();
 
+	/**
+	 * @return true if the message belongs to the mission, parameter, FTP or log protocol
+	 */
+	static bool is_bulk_message(uint32_t msgid);
+
+	/**
+	 * Pass a bulk protocol message to the worker, or handle it right away if there is none.
+	 */
+	void dispatch_bulk_message(mavlink_message_t *msg);
+	void handle_bulk_message(mavlink_message_t *msg);
+
+	/**
+	 * Run the mission, parameter, FTP and log transfer state machines.
+	 */
+	void update_bulk_protocols();
+
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+	static void *start_bulk_worker_trampoline(void *context);
+	void run_bulk_worker();
+	bool pop_bulk_message(mavlink_message_t &msg);
+#endif // MAVLINK_RECEIVER_BULK_WORKER
+
 	void acknowledge(uint8_t sysid, uint8_t compid, uint16_t command, uint8_t result, uint8_t progress = 0);
 
 	/**
@@ -214,6 +244,7 @@ private:
 	void handle_message_debug_float_array(mavlink_message_t *msg);
 	void handle_message_debug_vect(mavlink_message_t *msg);
 	void handle_message_named_value_float(mavlink_message_t *msg);
+	void handle_message_setup_signing(mavlink_message_t *msg);
 #endif // !CONSTRAINED_FLASH
 	void handle_message_request_event(mavlink_message_t *msg);
 
@@ -237,6 +268,13 @@ private:
 
 	void schedule_tune(const char *tune);
 
+#if !defined(CONSTRAINED_FLASH)
+	/**
+	 * Apply MAV_SIGN_CFG and reload the signing key if it changed.
+	 */
+	void update_signing();
+#endif // !CONSTRAINED_FLASH
+
 	void update_message_statistics(const mavlink_message_t &message);
 	void update_rx_stats(const mavlink_message_t &message);
 
@@ -244,6 +282,34 @@ private:
 
 	px4::atomic_bool 	_should_exit{false};
 	pthread_t		_thread {};
+
+#if defined(MAVLINK_RECEIVER_BULK_WORKER)
+	// Requests a GCS can have in flight before it waits for a reply. FTP, mission and log transfers are
+	// request/response (one per FTP session, plus a mission ACK/SET_CURRENT next to the transfer itself),
+	// parameter reads and writes are retried by the GCS in small batches.
+	static constexpr unsigned BULK_QUEUE_FTP_IN_FLIGHT{MavlinkFTP::kMaxSessions};
+	static constexpr unsigned BULK_QUEUE_MISSION_IN_FLIGHT{2};
+	static constexpr unsigned BULK_QUEUE_PARAM_IN_FLIGHT{8};
+	static constexpr unsigned BULK_QUEUE_LOG_IN_FLIGHT{1};
+	static constexpr unsigned BULK_QUEUE_SIZE{BULK_QUEUE_FTP_IN_FLIGHT + BULK_QUEUE_MISSION_IN_FLIGHT
+						  + BULK_QUEUE_PARAM_IN_FLIGHT + BULK_QUEUE_LOG_IN_FLIGHT};
+
+	// the handlers used to share the receive thread stack (minus the receiver object), the worker
+	// additionally holds one message copy
+	static constexpr size_t BULK_WORKER_STACK_SIZE{2840 + sizeof(mavlink_message_t)};
+
+	static constexpr unsigned FTP_BURST_INTERVAL{1000};	///< FTP burst send interval in us
+
+	mavlink_message_t	*_bulk_queue{nullptr};	///< allocated when the worker is started
+	unsigned		_bulk_queue_head{0};
+	unsigned		_bulk_queue_count{0};
+	unsigned		_bulk_queue_peak{0};	///< highest queue use, to validate BULK_QUEUE_SIZE
+	uint32_t		_bulk_queue_dropped{0};
+	pthread_mutex_t		_bulk_queue_mutex {};
+	px4_sem_t		_bulk_worker_sem {};
+	px4::atomic_bool	_bulk_update_requested{false};
+	pthread_t		_bulk_worker_thread {};
+#endif // MAVLINK_RECEIVER_BULK_WORKER
 	/**
 	 * @brief Updates optical flow parameters.
 	 */
@@ -255,6 +321,9 @@ private:
 	MavlinkLogHandler		_mavlink_log_handler;
 	MavlinkMissionManager		_mission_manager;
 	MavlinkParametersManager	_parameters_manager;
+#if !defined(CONSTRAINED_FLASH)
+	MavlinkSignVerify		_sign_verify;
+#endif // !CONSTRAINED_FLASH
 	MavlinkTimesync			_mavlink_timesync;
 	MavlinkStatustextHandler	_mavlink_statustext_handler;
 
@@ -408,7 +477,8 @@ private:
 		(ParamFloat<px4::params::BAT_LOW_THR>)      _param_bat_low_thr,
 		(ParamInt<px4::params::BAT1_N_CELLS>)       _param_bat_cells_count,
 		(ParamFloat<px4::params::BAT1_V_CHARGED>)   _param_bat_v_charged,
-		(ParamFloat<px4::params::BAT1_V_EMPTY>)     _param_bat_v_empty
+		(ParamFloat<px4::params::BAT1_V_EMPTY>)     _param_bat_v_empty,
+		(ParamInt<px4::params::MAV_SIGN_CFG>)       _param_mav_sign_cfg
 	);
 
 	// Disallow copy construction and move assignment.
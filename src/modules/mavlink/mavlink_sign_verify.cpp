@@ -0,0 +1,202 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+/**
+ * @file mavlink_sign_verify.cpp
+ * MAVLink 2 signing key handling for packet signature verification.
+ */
+
+#include "mavlink_sign_verify.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+constexpr char MavlinkSignVerify::KEY_FILE[];
+
+px4::atomic<uint32_t> MavlinkSignVerify::_key_generation{1};
+
+void MavlinkSignVerify::start(mavlink_status_t *status)
+{
+	_status = status;
+	_context.signing.accept_unsigned_callback = &MavlinkSignVerify::accept_unsigned;
+	attach();
+}
+
+void MavlinkSignVerify::stop()
+{
+	if (_status) {
+		store_timestamp();
+		_status->signing = nullptr;
+		_status->signing_streams = nullptr;
+		_status = nullptr;
+	}
+}
+
+void MavlinkSignVerify::set_enforced(bool enforced)
+{
+	if (enforced != _enforced) {
+		_enforced = enforced;
+		attach();
+	}
+}
+
+void MavlinkSignVerify::attach()
+{
+	if (_status) {
+		// without a signing context the MAVLink library accepts all packets without checking signatures
+		_status->signing_streams = &_signing_streams;
+		_status->signing = (_enforced && _has_key) ? &_context.signing : nullptr;
+	}
+}
+
+bool MavlinkSignVerify::accept_unsigned(const mavlink_status_t *status, uint32_t msgid)
+{
+	// the signing context is the first member of the Context, see attach()
+	MavlinkSignVerify *self = reinterpret_cast<const Context *>(status->signing)->owner;
+
+	// injected by telemetry radios, which don't know the key
+	if (msgid == MAVLINK_MSG_ID_RADIO_STATUS) {
+		return true;
+	}
+
+	self->_rejected++;
+	return false;
+}
+
+bool MavlinkSignVerify::update_key()
+{
+	const uint32_t generation = _key_generation.load();
+
+	if (generation == _loaded_generation) {
+		return _has_key;
+	}
+
+	_loaded_generation = generation;
+	_has_key = false;
+	_signing_streams.num_signing_streams = 0;
+
+	int fd = ::open(KEY_FILE, O_RDONLY);
+
+	if (fd >= 0) {
+		uint8_t buf[KEY_LEN + sizeof(uint64_t)];
+
+		if (::read(fd, buf, sizeof(buf)) == sizeof(buf)) {
+			memcpy(_context.signing.secret_key, buf, KEY_LEN);
+
+			uint64_t timestamp;
+			memcpy(&timestamp, &buf[KEY_LEN], sizeof(timestamp));
+
+			if (timestamp > _context.signing.timestamp) {
+				_context.signing.timestamp = timestamp;
+			}
+
+			_has_key = true;
+		}
+
+		::close(fd);
+	}
+
+	attach();
+
+	return _has_key;
+}
+
+bool MavlinkSignVerify::set_key(const uint8_t key[KEY_LEN], uint64_t timestamp)
+{
+	bool disable = true;
+
+	for (size_t i = 0; i < KEY_LEN; i++) {
+		if (key[i] != 0) {
+			disable = false;
+			break;
+		}
+	}
+
+	bool success = false;
+
+	if (disable) {
+		success = ::unlink(KEY_FILE) == 0 || errno == ENOENT;
+
+	} else {
+		int fd = ::open(KEY_FILE, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_600);
+
+		if (fd >= 0) {
+			uint8_t buf[KEY_LEN + sizeof(uint64_t)];
+			memcpy(buf, key, KEY_LEN);
+			memcpy(&buf[KEY_LEN], &timestamp, sizeof(timestamp));
+			success = ::write(fd, buf, sizeof(buf)) == sizeof(buf);
+			::close(fd);
+		}
+	}
+
+	_key_generation.fetch_add(1);
+
+	return success;
+}
+
+void MavlinkSignVerify::use_key(const uint8_t key[KEY_LEN])
+{
+	memcpy(_context.signing.secret_key, key, KEY_LEN);
+	_context.signing.timestamp = 0;
+	_signing_streams.num_signing_streams = 0;
+	_has_key = true;
+	_loaded_generation = _key_generation.load();
+	attach();
+}
+
+void MavlinkSignVerify::store_timestamp()
+{
+	if (!_has_key || _key_generation.load() != _loaded_generation) {
+		return;
+	}
+
+	// the MAVLink library moves the signing timestamp forward with every accepted packet
+	const uint64_t timestamp = _context.signing.timestamp;
+
+	int fd = ::open(KEY_FILE, O_RDWR);
+
+	if (fd >= 0) {
+		uint64_t stored = 0;
+
+		// only move the stored timestamp forward, another instance may have seen newer packets
+		if (::lseek(fd, KEY_LEN, SEEK_SET) == (off_t)KEY_LEN
+		    && ::read(fd, &stored, sizeof(stored)) == sizeof(stored)
+		    && timestamp > stored
+		    && ::lseek(fd, KEY_LEN, SEEK_SET) == (off_t)KEY_LEN) {
+			::write(fd, &timestamp, sizeof(timestamp));
+		}
+
+		::close(fd);
+	}
+}
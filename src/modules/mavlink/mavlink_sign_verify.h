@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+/**
+ * @file mavlink_sign_verify.h
+ * MAVLink 2 signing key handling for packet signature verification.
+ */
+
+#pragma once
+
+#include "mavlink_bridge_header.h"
+
+#include <stdint.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/defines.h>
+
+/**
+ * Provides the signing context of a MAVLink channel, so that the MAVLink library verifies the
+ * signature of incoming MAVLink 2 packets and rejects replayed timestamps while parsing.
+ *
+ * The secret key is shared by all instances through a file in the storage directory and
+ * cached by each instance, which reloads it when the key was changed by SETUP_SIGNING.
+ * Outgoing packets are not signed.
+ */
+class MavlinkSignVerify
+{
+public:
+	static constexpr size_t KEY_LEN{32};
+
+	MavlinkSignVerify() { _context.owner = this; }
+
+	/**
+	 * Attach to the status of the channel the packets are parsed with. Signatures are only
+	 * verified once signing is enforced and a key is available.
+	 */
+	void start(mavlink_status_t *status);
+
+	/**
+	 * Store the newest seen timestamp and detach from the channel status.
+	 */
+	void stop();
+
+	/**
+	 * Enforce signing: packets without a valid signature are dropped (except RADIO_STATUS).
+	 */
+	void set_enforced(bool enforced);
+
+	/**
+	 * Load the shared key, if it changed since the last load.
+	 * @return true if a key is available
+	 */
+	bool update_key();
+
+	/**
+	 * Set and store the shared key.
+	 * @param key secret key, all zeros disables signing
+	 * @param timestamp initial timestamp (10 us since 1.1.2015)
+	 * @return true on success
+	 */
+	static bool set_key(const uint8_t key[KEY_LEN], uint64_t timestamp);
+
+	/**
+	 * Use a key for this instance only, without storing it (for testing).
+	 */
+	void use_key(const uint8_t key[KEY_LEN]);
+
+	/**
+	 * Store the newest seen timestamp with the key, so packets captured before a reboot
+	 * cannot be replayed afterwards.
+	 */
+	void store_timestamp();
+
+	bool has_key() const { return _has_key; }
+	bool active() const { return _status && _status->signing; }
+
+	/// number of packets dropped because of a missing or invalid signature
+	uint32_t rejected() const { return _rejected; }
+
+private:
+	static constexpr char KEY_FILE[] {PX4_STORAGEDIR "/mavlink-signing-key.bin"};	///< key followed by timestamp
+
+	/// decides on packets without a valid signature, called by the MAVLink library while parsing
+	static bool accept_unsigned(const mavlink_status_t *status, uint32_t msgid);
+
+	/// hand the signing context to the channel status, or remove it if signing is not active
+	void attach();
+
+	/// the signing context handed to the MAVLink library, followed by its owner for accept_unsigned()
+	struct Context {
+		mavlink_signing_t signing;
+		MavlinkSignVerify *owner;
+	};
+
+	static px4::atomic<uint32_t> _key_generation;	///< incremented whenever the stored key changes
+
+	Context _context{};
+	mavlink_signing_streams_t _signing_streams{};
+	mavlink_status_t *_status{nullptr};
+
+	bool _has_key{false};
+	bool _enforced{false};
+	uint32_t _loaded_generation{0};
+	uint32_t _rejected{0};
+};
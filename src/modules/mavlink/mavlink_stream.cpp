@@ -50,6 +50,20 @@ MavlinkStream::MavlinkStream(Mavlink *mavlink) :
 	_last_sent = hrt_absolute_time();
 }
 
+void
+MavlinkStream::set_interval(const int interval)
+{
+	_interval = interval;
+	_mavlink->invalidate_stream_schedule();
+}
+
+void
+MavlinkStream::reset_last_sent()
+{
+	_last_sent = 0;
+	_mavlink->invalidate_stream_schedule();
+}
+
 /**
  * Update subscriptions and send message if necessary
  */
@@ -128,3 +142,31 @@ MavlinkStream::update(const hrt_abstime &t)
 
 	return -1;
 }
+
+hrt_abstime
+MavlinkStream::next_update(const hrt_abstime &t)
+{
+	if (update_data_required() || (_last_sent == 0)) {
+		return t;
+	}
+
+	int interval = _interval;
+
+	if (!const_rate()) {
+		interval /= _mavlink->get_rate_mult();
+	}
+
+	// only sent on request, see update()
+	if (interval == 0) {
+		return UINT64_MAX;
+	}
+
+	if (interval < 0) {
+		return t;
+	}
+
+	// first time at which the deadline check in update() passes
+	const int64_t deadline = (int64_t)_last_sent + interval - (_mavlink->get_main_loop_delay() / 10) * 3 + 1;
+
+	return (deadline > 0) ? deadline : 0;
+}
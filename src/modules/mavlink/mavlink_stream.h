@@ -66,7 +66,7 @@ public:
 	 *
 	 * @param interval the interval in microseconds (us) between messages
 	 */
-	void set_interval(const int interval) { _interval = interval; }
+	void set_interval(const int interval);
 
 	/**
 	 * Get the interval
@@ -79,6 +79,14 @@ public:
 	 * @return 0 if updated / sent, -1 if unchanged
 	 */
 	int update(const hrt_abstime &t);
+
+	/**
+	 * Earliest time at which update() can send a message, used to schedule the stream.
+	 *
+	 * @return absolute time in microseconds, t if the stream has to be updated right away
+	 */
+	hrt_abstime next_update(const hrt_abstime &t);
+
 	virtual const char *get_name() const = 0;
 	virtual uint16_t get_id() = 0;
 
@@ -120,7 +128,7 @@ public:
 	 * Reset the time of last sent to 0. Can be used if a message over this
 	 * stream needs to be sent immediately.
 	 */
-	void reset_last_sent() { _last_sent = 0; }
+	void reset_last_sent();
 
 protected:
 	Mavlink      *const _mavlink;
@@ -132,10 +140,17 @@ protected:
 	 * Function to collect/update data for the streams at a high rate independent of
 	 * actual stream rate.
 	 *
-	 * This function is called at every iteration of the mavlink module.
+	 * This function is called at every iteration of the mavlink module if
+	 * update_data_required() returns true.
 	 */
 	virtual void update_data() { }
 
+	/**
+	 * @return true if the stream implements update_data() and therefore needs
+	 * to be updated at every iteration, independent of its interval
+	 */
+	virtual bool update_data_required() const { return false; }
+
 private:
 	hrt_abstime _last_sent{0};
 	bool _first_message_sent{false};
@@ -0,0 +1,201 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.cpp
+ * Deadline ordered scheduling of mavlink streams.
+ */
+
+#include "mavlink_stream_scheduler.h"
+#include "mavlink_stream.h"
+
+#include <math.h>
+#include <px4_platform_common/log.h>
+
+MavlinkStreamScheduler::~MavlinkStreamScheduler()
+{
+	delete[] _entries;
+}
+
+bool
+MavlinkStreamScheduler::rebuild_required(float rate_mult) const
+{
+	// A stream picks up the current rate multiplier whenever it is rescheduled, so small changes
+	// converge by themselves within one interval. Only resort on significant changes.
+	return _invalid || (fabsf(rate_mult - _rate_mult) > 0.05f * _rate_mult);
+}
+
+void
+MavlinkStreamScheduler::rebuild(List<MavlinkStream *> &streams, const hrt_abstime &now, float rate_mult)
+{
+	if (!reserve(streams.size())) {
+		// drop the schedule, retry on the next iteration
+		_size = 0;
+		return;
+	}
+
+	_size = 0;
+
+	for (const auto &stream : streams) {
+		_entries[_size++] = Entry{stream->next_update(now), stream};
+	}
+
+	for (int i = (int)_size / 2 - 1; i >= 0; i--) {
+		sift_down(i);
+	}
+
+	_rate_mult = rate_mult;
+	_invalid = false;
+	_rebuilds++;
+}
+
+MavlinkStream *
+MavlinkStreamScheduler::pop_due(const hrt_abstime &now)
+{
+	if ((_size == 0) || (_entries[0].deadline > now)) {
+		return nullptr;
+	}
+
+	MavlinkStream *stream = _entries[0].stream;
+
+	_entries[0] = _entries[--_size];
+	sift_down(0);
+
+	return stream;
+}
+
+void
+MavlinkStreamScheduler::push(MavlinkStream *stream, const hrt_abstime &now)
+{
+	if (_size >= _capacity) {
+		// only possible if the stream list changed without invalidating the schedule
+		_invalid = true;
+		return;
+	}
+
+	const hrt_abstime deadline = stream->next_update(now);
+
+	_entries[_size] = Entry{(deadline > now) ? deadline : now + 1, stream};
+	sift_up(_size++);
+}
+
+void
+MavlinkStreamScheduler::record_loop(unsigned dispatched, const hrt_abstime &elapsed)
+{
+	_loops++;
+	_dispatched += dispatched;
+	_elapsed_us += elapsed;
+
+	if (elapsed > _elapsed_max_us) {
+		_elapsed_max_us = elapsed;
+	}
+}
+
+void
+MavlinkStreamScheduler::print_status() const
+{
+	if (_loops == 0) {
+		return;
+	}
+
+	printf("\tstream scheduler:\n");
+	printf("\t  due per loop: %.1f of %u\n", (double)_dispatched / _loops, _size);
+	printf("\t  time per loop: %.1f us (max %" PRIu64 " us)\n", (double)_elapsed_us / _loops, _elapsed_max_us);
+	printf("\t  rebuilds: %" PRIu32 "\n", _rebuilds);
+}
+
+bool
+MavlinkStreamScheduler::reserve(unsigned capacity)
+{
+	if (capacity <= _capacity) {
+		return true;
+	}
+
+	Entry *entries = new Entry[capacity];
+
+	if (entries == nullptr) {
+		PX4_ERR("stream scheduler alloc failed");
+		return false;
+	}
+
+	delete[] _entries;
+	_entries = entries;
+	_capacity = capacity;
+	_size = 0;
+
+	return true;
+}
+
+void
+MavlinkStreamScheduler::sift_up(unsigned index)
+{
+	while (index > 0) {
+		const unsigned parent = (index - 1) / 2;
+
+		if (_entries[parent].deadline <= _entries[index].deadline) {
+			break;
+		}
+
+		const Entry tmp = _entries[parent];
+		_entries[parent] = _entries[index];
+		_entries[index] = tmp;
+		index = parent;
+	}
+}
+
+void
+MavlinkStreamScheduler::sift_down(unsigned index)
+{
+	for (;;) {
+		const unsigned left = 2 * index + 1;
+		const unsigned right = left + 1;
+		unsigned smallest = index;
+
+		if ((left < _size) && (_entries[left].deadline < _entries[smallest].deadline)) {
+			smallest = left;
+		}
+
+		if ((right < _size) && (_entries[right].deadline < _entries[smallest].deadline)) {
+			smallest = right;
+		}
+
+		if (smallest == index) {
+			break;
+		}
+
+		const Entry tmp = _entries[smallest];
+		_entries[smallest] = _entries[index];
+		_entries[index] = tmp;
+		index = smallest;
+	}
+}
@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.h
+ * Deadline ordered scheduling of mavlink streams.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <containers/List.hpp>
+
+class MavlinkStream;
+
+/**
+ * Min-heap of streams keyed by the time they are next due. The main loop only
+ * dispatches the entries at the top of the heap that are due, instead of
+ * polling every configured stream each iteration.
+ */
+class MavlinkStreamScheduler
+{
+public:
+	MavlinkStreamScheduler() = default;
+	~MavlinkStreamScheduler();
+
+	// no copy, assignment, move, move assignment
+	MavlinkStreamScheduler(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler &operator=(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler(MavlinkStreamScheduler &&) = delete;
+	MavlinkStreamScheduler &operator=(MavlinkStreamScheduler &&) = delete;
+
+	/**
+	 * Mark the schedule as stale, e.g. after streams were added, removed or reconfigured.
+	 */
+	void invalidate() { _invalid = true; }
+
+	/**
+	 * @return true if the schedule needs to be rebuilt, either because it was invalidated
+	 * or because the rate multiplier moved significantly since the last rebuild.
+	 */
+	bool rebuild_required(float rate_mult) const;
+
+	/**
+	 * Rebuild the schedule from the stream list.
+	 */
+	void rebuild(List<MavlinkStream *> &streams, const hrt_abstime &now, float rate_mult);
+
+	/**
+	 * Remove and return the stream with the earliest deadline if it is due.
+	 *
+	 * @return stream or nullptr if no stream is due at time now
+	 */
+	MavlinkStream *pop_due(const hrt_abstime &now);
+
+	/**
+	 * Reinsert a dispatched stream with its next deadline.
+	 * Deadlines are pushed at least past now, so that a stream is dispatched at most once per loop.
+	 */
+	void push(MavlinkStream *stream, const hrt_abstime &now);
+
+	/**
+	 * Account one main loop iteration for the statistics.
+	 *
+	 * @param dispatched number of streams dispatched in this iteration
+	 * @param elapsed time spent scheduling and updating streams in this iteration
+	 */
+	void record_loop(unsigned dispatched, const hrt_abstime &elapsed);
+
+	void print_status() const;
+
+private:
+	struct Entry {
+		hrt_abstime deadline;
+		MavlinkStream *stream;
+	};
+
+	bool reserve(unsigned capacity);
+
+	void sift_up(unsigned index);
+	void sift_down(unsigned index);
+
+	Entry *_entries{nullptr};
+	unsigned _size{0};
+	unsigned _capacity{0};
+
+	float _rate_mult{1.f};		///< rate multiplier the current schedule was built with
+	bool _invalid{true};
+
+	// statistics
+	uint32_t _rebuilds{0};
+	uint64_t _loops{0};
+	uint64_t _dispatched{0};
+	uint64_t _elapsed_us{0};
+	hrt_abstime _elapsed_max_us{0};
+};
@@ -38,9 +38,11 @@
 #include <crc32.h>
 #include <stdio.h>
 #include <fcntl.h>
+#include <parameters/param.h>
 
 #include "mavlink_ftp_test.h"
 #include "../mavlink_ftp.h"
+#include "../mavlink_param_pack.h"
 
 #ifdef __PX4_NUTTX
 #define PX4_MAVLINK_TEST_DATA_DIR CONFIG_BOARD_ROOT_PATH "/ftp_unit_test_data"
@@ -551,7 +553,312 @@ bool MavlinkFtpTest::_read_test()
 	return true;
 }
 
+/// @brief Tests for reading from several concurrently open sessions.
+bool MavlinkFtpTest::_multi_session_test()
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+	uint8_t					sessions[MavlinkFTP::kMaxSessions];
+
+	static_assert(sizeof(_rgDownloadTestCases) / sizeof(_rgDownloadTestCases[0]) >= sizeof(sessions), "test case count");
+
+	// Open as many test files at once as there are sessions
+	for (size_t i = 0; i < sizeof(sessions); i++) {
+		const DownloadTestCase *test = &_rgDownloadTestCases[i];
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(test->file) + 1;
+
+		bool success = _send_receive_msg(&payload,		// FTP payload header
+						 (uint8_t *)test->file,	// Data to start into FTP message payload
+						 payload.size,	// size in bytes of data
+						 &reply);		// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+		sessions[i] = reply->session;
+
+		for (size_t j = 0; j < i; j++) {
+			ut_assert("Session reused", sessions[j] != sessions[i]);
+		}
+	}
+
+	// All sessions are in use now
+	{
+		const char *file = _rgDownloadTestCases[0].file;
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(file) + 1;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 (uint8_t *)file,	// Data to start into FTP message payload
+						 payload.size,	// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Nak back", reply->opcode, MavlinkFTP::kRspNak);
+		ut_compare("Incorrect error code", reply->data[0], MavlinkFTP::kErrNoSessionsAvailable);
+	}
+
+	// Read the last byte of each file, the test files count up from 0
+	for (size_t i = 0; i < sizeof(sessions); i++) {
+		const DownloadTestCase *test = &_rgDownloadTestCases[i];
+
+		payload.opcode = MavlinkFTP::kCmdReadFile;
+		payload.session = sessions[i];
+		payload.offset = test->length - 1;
+		payload.size = 1;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 nullptr,	// Data to start into FTP message payload
+						 0,		// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+		ut_compare("Payload size incorrect", reply->size, 1);
+		ut_compare("Payload content differs", reply->data[0], (uint8_t)(test->length - 1));
+	}
+
+	// Terminate all sessions
+	for (size_t i = 0; i < sizeof(sessions); i++) {
+		payload.opcode = MavlinkFTP::kCmdTerminateSession;
+		payload.session = sessions[i];
+		payload.size = 0;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 nullptr,	// Data to start into FTP message payload
+						 0,		// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	}
+
+	return true;
+}
+
 /// @brief Tests for correct reponse to a Read command on an open session.
+bool MavlinkFtpTest::_param_pack_test()
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+	MavlinkParamPack::Header		header{};
+	char					path[64];
+
+	// First a full download, then an incremental one based on it which should come back empty
+	for (int pass = 0; pass < 2; pass++) {
+		if (pass == 0) {
+			snprintf(path, sizeof(path), "%s", MavlinkParamPack::kPath);
+
+		} else {
+			snprintf(path, sizeof(path), "%s?since=%u,%u", MavlinkParamPack::kPath, (unsigned)header.generation,
+				 (unsigned)header.hash);
+		}
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(path) + 1;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 (uint8_t *)path,	// Data to start into FTP message payload
+						 payload.size,	// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+
+		const uint8_t session = reply->session;
+		uint32_t file_size;
+		memcpy(&file_size, reply->data, sizeof(file_size));
+		ut_assert("File too small", file_size >= sizeof(header));
+
+		payload.opcode = MavlinkFTP::kCmdReadFile;
+		payload.session = session;
+		payload.offset = 0;
+		payload.size = sizeof(header);
+
+		success = _send_receive_msg(&payload,	// FTP payload header
+					    nullptr,	// Data to start into FTP message payload
+					    0,		// size in bytes of data
+					    &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+		ut_compare("Payload size incorrect", reply->size, sizeof(header));
+		memcpy(&header, reply->data, sizeof(header));
+
+		ut_compare("Wrong magic", header.magic, MavlinkParamPack::kMagic);
+		ut_compare("Wrong total", header.total, param_count_used());
+
+		if (pass == 0) {
+			ut_compare("Unexpected delta", header.flags & MavlinkParamPack::kFlagDelta, 0);
+			ut_compare("Not all params packed", header.count, header.total);
+
+		} else {
+			ut_compare("Expected delta", header.flags & MavlinkParamPack::kFlagDelta, MavlinkParamPack::kFlagDelta);
+			ut_compare("Unchanged params packed", header.count, 0);
+		}
+
+		payload.opcode = MavlinkFTP::kCmdTerminateSession;
+		payload.session = session;
+		payload.size = 0;
+
+		success = _send_receive_msg(&payload,	// FTP payload header
+					    nullptr,	// Data to start into FTP message payload
+					    0,		// size in bytes of data
+					    &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	}
+
+	return true;
+}
+
+/// @brief Tests generated files of two FTP instances (one per MAVLink link) using the same session slot.
+bool MavlinkFtpTest::_param_pack_instances_test()
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+	MavlinkParamPack::Header		header{};
+	char					path[64];
+
+	Mavlink					second_mavlink;
+	MavlinkFTP				second_ftp_server(second_mavlink);
+	MavlinkFTP				*ftp_servers[2] {_ftp_server, &second_ftp_server};
+	uint8_t					sessions[2] {};
+	uint32_t				file_sizes[2] {};
+
+	second_ftp_server.set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	snprintf(path, sizeof(path), "%s", MavlinkParamPack::kPath);
+
+	// Open the packed parameters on both instances
+	for (int i = 0; i < 2; i++) {
+		_ftp_server = ftp_servers[i];
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(path) + 1;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 (uint8_t *)path,	// Data to start into FTP message payload
+						 payload.size,	// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		_ftp_server = ftp_servers[0];
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+		sessions[i] = reply->session;
+		memcpy(&file_sizes[i], reply->data, sizeof(file_sizes[i]));
+	}
+
+	ut_compare("Packed sizes differ", file_sizes[0], file_sizes[1]);
+
+	// Close the second instance's session, this must not affect the first one
+	_ftp_server = ftp_servers[1];
+
+	payload.opcode = MavlinkFTP::kCmdTerminateSession;
+	payload.session = sessions[1];
+	payload.size = 0;
+
+	bool success = _send_receive_msg(&payload,	// FTP payload header
+					 nullptr,	// Data to start into FTP message payload
+					 0,		// size in bytes of data
+					 &reply);	// Payload inside FTP message response
+
+	_ftp_server = ftp_servers[0];
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+
+	// The first instance still reads its complete file
+	payload.opcode = MavlinkFTP::kCmdReadFile;
+	payload.session = sessions[0];
+	payload.offset = 0;
+	payload.size = sizeof(header);
+
+	success = _send_receive_msg(&payload,	// FTP payload header
+				    nullptr,	// Data to start into FTP message payload
+				    0,		// size in bytes of data
+				    &reply);	// Payload inside FTP message response
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	ut_compare("Payload size incorrect", reply->size, sizeof(header));
+	memcpy(&header, reply->data, sizeof(header));
+	ut_compare("Wrong magic", header.magic, MavlinkParamPack::kMagic);
+	ut_compare("Not all params packed", header.count, header.total);
+
+	payload.opcode = MavlinkFTP::kCmdReadFile;
+	payload.session = sessions[0];
+	payload.offset = file_sizes[0] - 1;
+	payload.size = 1;
+
+	success = _send_receive_msg(&payload,	// FTP payload header
+				    nullptr,	// Data to start into FTP message payload
+				    0,		// size in bytes of data
+				    &reply);	// Payload inside FTP message response
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	ut_compare("Payload size incorrect", reply->size, 1);
+
+	payload.opcode = MavlinkFTP::kCmdTerminateSession;
+	payload.session = sessions[0];
+	payload.size = 0;
+
+	success = _send_receive_msg(&payload,	// FTP payload header
+				    nullptr,	// Data to start into FTP message payload
+				    0,		// size in bytes of data
+				    &reply);	// Payload inside FTP message response
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+
+	return true;
+}
+
 bool MavlinkFtpTest::_burst_test()
 {
 	MavlinkFTP::PayloadHeader		payload {};
@@ -644,6 +951,116 @@ bool MavlinkFtpTest::_burst_test()
 	return true;
 }
 
+/// @brief Tests burst downloads running concurrently in all sessions.
+bool MavlinkFtpTest::_interleaved_burst_test()
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+	InterleavedBurstInfo			burst_info {};
+	const size_t				session_count = sizeof(burst_info.session);
+
+	static_assert(sizeof(_rgDownloadTestCases) / sizeof(_rgDownloadTestCases[0]) >= MavlinkFTP::kMaxSessions,
+		      "test case count");
+
+	burst_info.ftp_test_class = this;
+
+	// Open as many test files at once as there are sessions
+	for (size_t i = 0; i < session_count; i++) {
+		struct stat st;
+		const DownloadTestCase *test = &_rgDownloadTestCases[i];
+
+		// Read in the file so we can compare it to what we get back
+		ut_compare("stat failed", stat(test->file, &st), 0);
+		burst_info.file_bytes[i] = new uint8_t[st.st_size];
+		ut_assert("new failed", burst_info.file_bytes[i] != nullptr);
+		int fd = ::open(test->file, O_RDONLY);
+		ut_assert("open failed", fd != -1);
+		int bytes_read = ::read(fd, burst_info.file_bytes[i], st.st_size);
+		ut_compare("read failed", bytes_read, st.st_size);
+		::close(fd);
+
+		burst_info.file_size[i] = st.st_size;
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(test->file) + 1;
+
+		bool success = _send_receive_msg(&payload,		// FTP payload header
+						 (uint8_t *)test->file,	// Data to start into FTP message payload
+						 payload.size,	// size in bytes of data
+						 &reply);		// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+		burst_info.session[i] = reply->session;
+	}
+
+	// Start a burst in every session before any of them is served
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_interleaved_burst, &burst_info);
+
+	for (size_t i = 0; i < session_count; i++) {
+		payload.opcode = MavlinkFTP::kCmdBurstReadFile;
+		payload.session = burst_info.session[i];
+		payload.offset = 0;
+		payload.size = MAX_DATA_LEN;
+
+		mavlink_message_t msg;
+		_setup_ftp_msg(&payload, nullptr, 0, &msg);
+
+		// stream packets continue the sequence of the burst request
+		burst_info.seq_number[i] = _expected_seq_number;
+
+		_ftp_server->handle_message(&msg);
+	}
+
+	// Each send serves the next session in turn, the unit test build streams a whole file at once
+	for (size_t i = 0; i < session_count; i++) {
+		_ftp_server->send();
+
+		size_t complete_count = 0;
+
+		for (size_t j = 0; j < session_count; j++) {
+			if (burst_info.complete[j]) {
+				complete_count++;
+			}
+		}
+
+		ut_assert("Stream packet error", !burst_info.failed);
+		ut_compare("Sessions not served in turn", complete_count, i + 1);
+	}
+
+	ut_compare("All packets should have been sent", _ftp_server->get_size(), 0);
+
+	// Put back generic message handler
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	// Terminate all sessions
+	for (size_t i = 0; i < session_count; i++) {
+		payload.opcode = MavlinkFTP::kCmdTerminateSession;
+		payload.session = burst_info.session[i];
+		payload.size = 0;
+
+		bool success = _send_receive_msg(&payload,	// FTP payload header
+						 nullptr,	// Data to start into FTP message payload
+						 0,		// size in bytes of data
+						 &reply);	// Payload inside FTP message response
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+
+		delete[] burst_info.file_bytes[i];
+		burst_info.file_bytes[i] = nullptr;
+	}
+
+	return true;
+}
+
 /// @brief Tests for correct reponse to a Read command on an invalid session.
 bool MavlinkFtpTest::_read_badsession_test()
 {
@@ -929,6 +1346,54 @@ bool MavlinkFtpTest::_receive_message_handler_burst(const mavlink_file_transfer_
 	return true;
 }
 
+/// Static method used as callback from MavlinkFTP for interleaved burst download testing.
+void MavlinkFtpTest::receive_message_handler_interleaved_burst(const mavlink_file_transfer_protocol_t *ftp_req,
+		void *worker_data)
+{
+	InterleavedBurstInfo *burst_info = (InterleavedBurstInfo *)worker_data;
+
+	if (!burst_info->ftp_test_class->_receive_message_handler_interleaved_burst(ftp_req, burst_info)) {
+		burst_info->failed = true;
+	}
+}
+
+bool MavlinkFtpTest::_receive_message_handler_interleaved_burst(const mavlink_file_transfer_protocol_t *ftp_msg,
+		InterleavedBurstInfo *burst_info)
+{
+	// sequence numbers are counted per session, so don't use _decode_message()
+	ut_compare("Target network non-zero", ftp_msg->target_network, 0);
+	ut_compare("Target system id mismatch", ftp_msg->target_system, clientSystemId);
+	ut_compare("Target component id mismatch", ftp_msg->target_component, clientComponentId);
+
+	const MavlinkFTP::PayloadHeader *reply = reinterpret_cast<const MavlinkFTP::PayloadHeader *>(ftp_msg->payload);
+
+	size_t i = 0;
+
+	while ((i < sizeof(burst_info->session)) && (burst_info->session[i] != reply->session)) {
+		i++;
+	}
+
+	ut_assert("Unknown session", i < sizeof(burst_info->session));
+	ut_assert("Packet after the end of the burst", !burst_info->complete[i]);
+	ut_compare("Sequence number mismatch", reply->seq_number, burst_info->seq_number[i]);
+	burst_info->seq_number[i]++;
+
+	if (reply->opcode == MavlinkFTP::kRspNak) {
+		ut_compare("Incorrect error code", reply->data[0], MavlinkFTP::kErrEOF);
+		ut_compare("File incomplete", burst_info->offset[i], burst_info->file_size[i]);
+		burst_info->complete[i] = true;
+		return true;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	ut_compare("Offset incorrect", reply->offset, burst_info->offset[i]);
+	ut_assert("Payload past end of file", reply->offset + reply->size <= burst_info->file_size[i]);
+	ut_compare("File contents differ", memcmp(reply->data, &burst_info->file_bytes[i][reply->offset], reply->size), 0);
+	burst_info->offset[i] += reply->size;
+
+	return true;
+}
+
 /// @brief Decode and validate the incoming message
 bool MavlinkFtpTest::_decode_message(const mavlink_file_transfer_protocol_t	*ftp_msg,	///< Incoming FTP message
 				     const MavlinkFTP::PayloadHeader		**payload)	///< Payload inside FTP message response
@@ -1016,7 +1481,11 @@ bool MavlinkFtpTest::run_tests()
 	ut_run_test(_terminate_badsession_test);
 	ut_run_test(_read_test);
 	ut_run_test(_read_badsession_test);
+	ut_run_test(_multi_session_test);
+	ut_run_test(_param_pack_test);
+	ut_run_test(_param_pack_instances_test);
 	ut_run_test(_burst_test);
+	ut_run_test(_interleaved_burst_test);
 	ut_run_test(_removedirectory_test);
 	ut_run_test(_createdirectory_test);
 	ut_run_test(_removefile_test);
@@ -62,6 +62,21 @@ public:
 
 	static void receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data);
 
+	/// Worker data for the interleaved burst handler, one entry per session
+	struct InterleavedBurstInfo {
+		MavlinkFtpTest		*ftp_test_class;
+		uint8_t			session[MavlinkFTP::kMaxSessions];
+		uint16_t		seq_number[MavlinkFTP::kMaxSessions];	///< next expected sequence number
+		uint32_t		offset[MavlinkFTP::kMaxSessions];	///< next expected offset
+		uint32_t		file_size[MavlinkFTP::kMaxSessions];
+		uint8_t			*file_bytes[MavlinkFTP::kMaxSessions];
+		bool			complete[MavlinkFTP::kMaxSessions];
+		bool			failed;
+	};
+
+	static void receive_message_handler_interleaved_burst(const mavlink_file_transfer_protocol_t *ftp_req,
+			void *worker_data);
+
 	static const uint8_t serverSystemId = 50;	///< System ID for server
 	static const uint8_t serverComponentId = 1;	///< Component ID for server
 	static const uint8_t serverChannel = 0;		///< Channel to send to
@@ -89,7 +104,11 @@ private:
 	bool _terminate_badsession_test(void);
 	bool _read_test(void);
 	bool _read_badsession_test(void);
+	bool _multi_session_test(void);
+	bool _param_pack_test(void);
+	bool _param_pack_instances_test(void);
 	bool _burst_test(void);
+	bool _interleaved_burst_test(void);
 	bool _removedirectory_test(void);
 	bool _createdirectory_test(void);
 	bool _removefile_test(void);
@@ -125,6 +144,8 @@ private:
 	};
 
 	bool _receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, BurstInfo *burst_info);
+	bool _receive_message_handler_interleaved_burst(const mavlink_file_transfer_protocol_t *ftp_req,
+			InterleavedBurstInfo *burst_info);
 
 	MavlinkFTP	*_ftp_server;
 	Mavlink _mavlink;
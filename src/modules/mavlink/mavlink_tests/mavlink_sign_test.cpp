@@ -0,0 +1,180 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+/// @file mavlink_sign_test.cpp
+/// MAVLink signature verification tests.
+
+#include "mavlink_sign_test.h"
+
+#include <string.h>
+
+const uint8_t MavlinkSignTest::_key[MavlinkSignVerify::KEY_LEN] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+};
+
+void MavlinkSignTest::_pack(uint8_t *buf, uint16_t &len, uint32_t msgid, bool sign, const uint8_t key[MavlinkSignVerify::KEY_LEN],
+			    uint8_t link_id, uint64_t timestamp)
+{
+	mavlink_signing_t signing{};
+	signing.flags = MAVLINK_SIGNING_FLAG_SIGN_OUTGOING;
+	signing.link_id = link_id;
+	signing.timestamp = timestamp;
+	memcpy(signing.secret_key, key, sizeof(signing.secret_key));
+
+	mavlink_status_t status{};
+	status.signing = sign ? &signing : nullptr;
+
+	mavlink_message_t msg{};
+	msg.msgid = msgid;
+
+	if (msgid == MAVLINK_MSG_ID_RADIO_STATUS) {
+		mavlink_radio_status_t radio_status{};
+		radio_status.rssi = 100;
+		memcpy(_MAV_PAYLOAD_NON_CONST(&msg), &radio_status, sizeof(radio_status));
+		mavlink_finalize_message_buffer(&msg, 51, 68, &status, MAVLINK_MSG_ID_RADIO_STATUS_MIN_LEN,
+						MAVLINK_MSG_ID_RADIO_STATUS_LEN, MAVLINK_MSG_ID_RADIO_STATUS_CRC);
+
+	} else {
+		mavlink_heartbeat_t heartbeat{};
+		heartbeat.type = MAV_TYPE_GCS;
+		heartbeat.autopilot = MAV_AUTOPILOT_INVALID;
+		memcpy(_MAV_PAYLOAD_NON_CONST(&msg), &heartbeat, sizeof(heartbeat));
+		mavlink_finalize_message_buffer(&msg, 255, 190, &status, MAVLINK_MSG_ID_HEARTBEAT_MIN_LEN,
+						MAVLINK_MSG_ID_HEARTBEAT_LEN, MAVLINK_MSG_ID_HEARTBEAT_CRC);
+	}
+
+	len = mavlink_msg_to_send_buffer(buf, &msg);
+}
+
+uint8_t MavlinkSignTest::_parse(mavlink_status_t &status, const uint8_t *buf, uint16_t len)
+{
+	mavlink_message_t rx_buffer{};
+	mavlink_message_t msg;
+	mavlink_status_t rx_status;
+	uint8_t result = MAVLINK_FRAMING_INCOMPLETE;
+
+	for (uint16_t i = 0; i < len; i++) {
+		result = mavlink_frame_char_buffer(&rx_buffer, &status, buf[i], &msg, &rx_status);
+	}
+
+	return result;
+}
+
+bool MavlinkSignTest::_verify_test(void)
+{
+	MavlinkSignVerify verify;
+	mavlink_status_t status{};
+	verify.start(&status);
+
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	uint16_t len;
+
+	// nothing is checked as long as signing is not enforced or there is no key
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, false, _key, 0, 0);
+	ut_compare("unsigned, no key", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	verify.use_key(_key);
+	ut_compare("unsigned, not enforced", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	verify.set_enforced(true);
+	ut_assert("active", verify.active());
+	ut_compare("unsigned", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	_pack(buf, len, MAVLINK_MSG_ID_RADIO_STATUS, false, _key, 0, 0);
+	ut_compare("unsigned radio status", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 0, 1000);
+	ut_compare("signed", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 0, 1001);
+	buf[len - 1] ^= 1;
+	ut_compare("tampered signature", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	uint8_t other_key[MavlinkSignVerify::KEY_LEN];
+	memcpy(other_key, _key, sizeof(other_key));
+	other_key[0] ^= 1;
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, other_key, 0, 1002);
+	ut_compare("wrong key", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	ut_compare("rejected count", verify.rejected(), 3);
+
+	verify.set_enforced(false);
+	ut_assert("inactive", !verify.active());
+	ut_compare("wrong key, not enforced", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	return true;
+}
+
+bool MavlinkSignTest::_replay_test(void)
+{
+	MavlinkSignVerify verify;
+	mavlink_status_t status{};
+	verify.start(&status);
+	verify.use_key(_key);
+	verify.set_enforced(true);
+
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	uint16_t len;
+
+	const uint64_t t0 = 100ULL * 60 * 100000;
+
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 0, t0);
+	ut_compare("first", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+	ut_compare("replayed", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 0, t0 - 1);
+	ut_compare("older", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 0, t0 + 1);
+	ut_compare("newer", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	// streams are tracked separately per link
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 1, t0 - 100);
+	ut_compare("other link", _parse(status, buf, len), MAVLINK_FRAMING_OK);
+
+	// a new stream must not lag too far behind
+	_pack(buf, len, MAVLINK_MSG_ID_HEARTBEAT, true, _key, 2, t0 - 2ULL * 60 * 100000);
+	ut_compare("stale stream", _parse(status, buf, len), MAVLINK_FRAMING_BAD_SIGNATURE);
+
+	return true;
+}
+
+bool MavlinkSignTest::run_tests(void)
+{
+	ut_run_test(_verify_test);
+	ut_run_test(_replay_test);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test(mavlink_sign_test, MavlinkSignTest)
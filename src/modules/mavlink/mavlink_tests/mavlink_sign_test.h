@@ -0,0 +1,64 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/// @file mavlink_sign_test.h
+/// MAVLink signature verification tests.
+
+#pragma once
+
+#include <unit_test.h>
+#include "../mavlink_sign_verify.h"
+
+class MavlinkSignTest : public UnitTest
+{
+public:
+	MavlinkSignTest() = default;
+	virtual ~MavlinkSignTest() = default;
+
+	virtual bool run_tests(void);
+
+private:
+	bool _verify_test(void);
+	bool _replay_test(void);
+
+	/// Serialize a HEARTBEAT or RADIO_STATUS packet, optionally signed with the given key, link ID and timestamp
+	static void _pack(uint8_t *buf, uint16_t &len, uint32_t msgid, bool sign, const uint8_t key[MavlinkSignVerify::KEY_LEN],
+			  uint8_t link_id, uint64_t timestamp);
+
+	/// Parse a packet with the given channel status, returns the MAVLINK_FRAMING_* result of the last byte
+	static uint8_t _parse(mavlink_status_t &status, const uint8_t *buf, uint16_t len);
+
+	static const uint8_t _key[MavlinkSignVerify::KEY_LEN];
+};
+
+bool mavlink_sign_test(void);
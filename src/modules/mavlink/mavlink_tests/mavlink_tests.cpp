@@ -38,10 +38,14 @@
 #include <systemlib/err.h>
 
 #include "mavlink_ftp_test.h"
+#include "mavlink_sign_test.h"
 
 extern "C" __EXPORT int mavlink_tests_main(int argc, char *argv[]);
 
 int mavlink_tests_main(int argc, char *argv[])
 {
-	return mavlink_ftp_test() ? 0 : -1;
+	bool ftp_passed = mavlink_ftp_test();
+	bool sign_passed = mavlink_sign_test();
+
+	return (ftp_passed && sign_passed) ? 0 : -1;
 }
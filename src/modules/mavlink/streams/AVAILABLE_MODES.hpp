@@ -196,6 +196,8 @@ private:
 		return ret;
 	}
 
+	bool update_data_required() const override { return true; }
+
 	void update_data() override
 	{
 		// Keep track of externally registered modes
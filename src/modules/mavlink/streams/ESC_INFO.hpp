@@ -85,6 +85,8 @@ private:
 	EscOutputInterfaceInfo _interface[MAX_NUM_MSGS] = {};
 	EscInfo _escs[MAX_ESC_OUTPUTS] = {};
 
+	bool update_data_required() const override { return true; }
+
 	void update_data() override
 	{
 		int subscriber_count = math::min(_esc_status_subs.size(), MAX_NUM_MSGS);
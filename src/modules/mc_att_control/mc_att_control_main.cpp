@@ -218,8 +218,11 @@ MulticopterAttitudeControl::Run()
 		parameter_update_s param_update;
 		_parameter_update_sub.copy(&param_update);
 
-		updateParams();
-		parameters_updated();
+		// skip recalculating the controller for changes of other modules' parameters
+		if (paramsChanged(param_update)) {
+			updateParams();
+			parameters_updated();
+		}
 	}
 
 	// Update hover thrust for stick scaling
@@ -116,8 +116,11 @@ MulticopterRateControl::Run()
 		parameter_update_s param_update;
 		_parameter_update_sub.copy(&param_update);
 
-		updateParams();
-		parameters_updated();
+		// skip recalculating the controller for changes of other modules' parameters
+		if (paramsChanged(param_update)) {
+			updateParams();
+			parameters_updated();
+		}
 	}
 
 	/* run controller on gyro changes */
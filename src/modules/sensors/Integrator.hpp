@@ -165,24 +165,51 @@ public:
 	{
 		if ((dt > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
 			// Use trapezoidal integration to calculate the delta integral
-			const matrix::Vector3f delta_alpha{integrate(val, dt)};
+			accumulate(integrate(val, dt));
 
-			// Calculate coning corrections
-			// Coning compensation derived by Paul Riseborough and Jonathan Challinger,
-			// following:
-			// Strapdown Inertial Navigation Integration Algorithm Design Part 1: Attitude Algorithms
-			// Sourced: https://arc.aiaa.org/doi/pdf/10.2514/2.4228
-			// Simulated: https://github.com/priseborough/InertialNav/blob/master/models/imu_error_modelling.m
-			_beta += ((_last_alpha + _last_delta_alpha * (1.f / 6.f)) % delta_alpha) * 0.5f;
-			_last_delta_alpha = delta_alpha;
-			_last_alpha = _alpha;
+		} else {
+			reset();
+			_last_val = val;
+		}
+	}
+
+	/**
+	 * Put a block of equally spaced raw samples (eg. a complete sensor FIFO read) into the integral.
+	 * Coning corrections are calculated at the raw sample rate, but the block only counts as a single
+	 * sample towards the reset configuration (see set_reset_samples()).
+	 *
+	 * @param x		Raw X-axis samples.
+	 * @param y		Raw Y-axis samples.
+	 * @param z		Raw Z-axis samples.
+	 * @param samples	Number of samples in the block.
+	 * @param scale		Scale factor converting the raw samples.
+	 * @param dt		Time interval covered by the whole block.
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], const uint8_t samples, const float scale,
+			const float dt)
+	{
+		if (samples == 0) {
+			return;
+		}
 
-			// accumulate delta integrals
-			_alpha += delta_alpha;
+		const float dt_sample = dt / samples;
+
+		if ((dt_sample > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
+			const float half_dt = 0.5f * dt_sample;
+
+			for (int n = 0; n < samples; n++) {
+				// Use trapezoidal integration to calculate the delta integral of each sample
+				const matrix::Vector3f val{x[n] * scale, y[n] * scale, z[n] * scale};
+				accumulate((val + _last_val) * half_dt);
+				_last_val = val;
+			}
+
+			_integral_dt += dt;
+			_integrated_samples++;
 
 		} else {
 			reset();
-			_last_val = val;
+			_last_val = matrix::Vector3f{x[samples - 1] * scale, y[samples - 1] * scale, z[samples - 1] * scale};
 		}
 	}
 
@@ -214,10 +241,146 @@ public:
 	}
 
 private:
+
+	inline void accumulate(const matrix::Vector3f &delta_alpha)
+	{
+		// Calculate coning corrections
+		// Coning compensation derived by Paul Riseborough and Jonathan Challinger,
+		// following:
+		// Strapdown Inertial Navigation Integration Algorithm Design Part 1: Attitude Algorithms
+		// Sourced: https://arc.aiaa.org/doi/pdf/10.2514/2.4228
+		// Simulated: https://github.com/priseborough/InertialNav/blob/master/models/imu_error_modelling.m
+		_beta += ((_last_alpha + _last_delta_alpha * (1.f / 6.f)) % delta_alpha) * 0.5f;
+		_last_delta_alpha = delta_alpha;
+		_last_alpha = _alpha;
+
+		// accumulate delta integrals
+		_alpha += delta_alpha;
+	}
+
 	matrix::Vector3f _beta{0.f, 0.f, 0.f};             /**< accumulated coning corrections */
 	matrix::Vector3f _last_delta_alpha{0.f, 0.f, 0.f}; /**< integral from previous previous sampling interval */
 	matrix::Vector3f _last_alpha{0.f, 0.f, 0.f};       /**< previous value of _alpha */
 
 };
 
+class IntegratorSculling : public Integrator
+{
+public:
+	IntegratorSculling() = default;
+	~IntegratorSculling() = default;
+
+	/**
+	 * Put an item into the integral.
+	 *
+	 * @param val			Item to put.
+	 * @param angular_velocity	Angular velocity in the same frame, used for the sculling corrections.
+	 * @param dt			Time interval since the previous item.
+	 */
+	inline void put(const matrix::Vector3f &val, const matrix::Vector3f &angular_velocity, const float dt)
+	{
+		if ((dt > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
+			// Use trapezoidal integration to calculate the delta integral
+			accumulate(integrate(val, dt), angular_velocity * dt);
+
+		} else {
+			reset();
+			_last_val = val;
+		}
+	}
+
+	/**
+	 * Put a block of equally spaced raw samples (eg. a complete sensor FIFO read) into the integral.
+	 * Sculling corrections are calculated at the raw sample rate, but the block only counts as a single
+	 * sample towards the reset configuration (see set_reset_samples()).
+	 *
+	 * @param x			Raw X-axis samples.
+	 * @param y			Raw Y-axis samples.
+	 * @param z			Raw Z-axis samples.
+	 * @param samples		Number of samples in the block.
+	 * @param scale			Scale factor converting the raw samples.
+	 * @param angular_velocity	Angular velocity in the same frame over the block, used for the sculling corrections.
+	 * @param dt			Time interval covered by the whole block.
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], const uint8_t samples, const float scale,
+			const matrix::Vector3f &angular_velocity, const float dt)
+	{
+		if (samples == 0) {
+			return;
+		}
+
+		const float dt_sample = dt / samples;
+
+		if ((dt_sample > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
+			const float half_dt = 0.5f * dt_sample;
+			const matrix::Vector3f delta_theta{angular_velocity * dt_sample};
+
+			for (int n = 0; n < samples; n++) {
+				// Use trapezoidal integration to calculate the delta integral of each sample
+				const matrix::Vector3f val{x[n] * scale, y[n] * scale, z[n] * scale};
+				accumulate((val + _last_val) * half_dt, delta_theta);
+				_last_val = val;
+			}
+
+			_integral_dt += dt;
+			_integrated_samples++;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[samples - 1] * scale, y[samples - 1] * scale, z[samples - 1] * scale};
+		}
+	}
+
+	void reset()
+	{
+		Integrator::reset();
+		_beta.zero();
+		_theta.zero();
+	}
+
+	const matrix::Vector3f &accumulated_sculling_corrections() const { return _beta; }
+
+	/* Reset integrator and return current integral & integration time
+	 *
+	 * @param integral_dt	Get the dt in us of the current integration.
+	 * @return		true if integral valid
+	 */
+	bool reset(matrix::Vector3f &integral, uint32_t &integral_dt)
+	{
+		if (Integrator::reset(integral, integral_dt)) {
+			// apply sculling corrections
+			integral += _beta;
+			_beta.zero();
+			_theta.zero();
+			return true;
+		}
+
+		return false;
+	}
+
+private:
+
+	inline void accumulate(const matrix::Vector3f &delta_v, const matrix::Vector3f &delta_theta)
+	{
+		// Calculate sculling corrections, the counterpart of the coning corrections for the delta velocity:
+		// Strapdown Inertial Navigation Integration Algorithm Design Part 2: Velocity and Position Algorithms
+		// Sourced: https://arc.aiaa.org/doi/pdf/10.2514/2.4242
+		// Only the sculling term is accumulated, the rotation compensation (0.5 * theta x v) is not included.
+		_beta += ((_theta + _last_delta_theta * (1.f / 6.f)) % delta_v
+			  + (_alpha + _last_delta_v * (1.f / 6.f)) % delta_theta) * 0.5f;
+		_last_delta_v = delta_v;
+		_last_delta_theta = delta_theta;
+
+		// accumulate delta integrals
+		_alpha += delta_v;
+		_theta += delta_theta;
+	}
+
+	matrix::Vector3f _beta{0.f, 0.f, 0.f};             /**< accumulated sculling corrections */
+	matrix::Vector3f _theta{0.f, 0.f, 0.f};            /**< delta angle integrated over the current interval */
+	matrix::Vector3f _last_delta_v{0.f, 0.f, 0.f};     /**< delta integral from the previous sampling interval */
+	matrix::Vector3f _last_delta_theta{0.f, 0.f, 0.f}; /**< delta angle from the previous sampling interval */
+
+};
+
 }; // namespace sensors
@@ -0,0 +1,208 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the Integrator classes
+ * Run this test only using make tests TESTFILTER=Integrator
+ */
+
+#include <gtest/gtest.h>
+
+#include "Integrator.hpp"
+
+using namespace sensors;
+using matrix::Vector3f;
+
+static constexpr uint8_t SAMPLES = 8;
+static constexpr float SCALE = 0.001f;
+static constexpr float DT_SAMPLE = 125e-6f; // 8 kHz raw samples
+
+class IntegratorTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		// arbitrary raw FIFO data
+		for (int n = 0; n < SAMPLES; n++) {
+			_x[n] = 1000 + 300 * n;
+			_y[n] = -2000 + 150 * n * n;
+			_z[n] = 500 - 700 * n;
+		}
+	}
+
+	Vector3f sample(int n) const { return Vector3f{_x[n] * SCALE, _y[n] * SCALE, _z[n] * SCALE}; }
+
+	int16_t _x[SAMPLES] {};
+	int16_t _y[SAMPLES] {};
+	int16_t _z[SAMPLES] {};
+};
+
+TEST_F(IntegratorTest, ConingBlockMatchesSamples)
+{
+	IntegratorConing per_sample;
+	IntegratorConing block;
+
+	// first put initializes the previous value
+	per_sample.put(sample(SAMPLES - 1), 0.f);
+	block.put(sample(SAMPLES - 1), 0.f);
+
+	for (int i = 0; i < 3; i++) {
+		for (int n = 0; n < SAMPLES; n++) {
+			per_sample.put(sample(n), DT_SAMPLE);
+		}
+
+		block.put(_x, _y, _z, SAMPLES, SCALE, SAMPLES * DT_SAMPLE);
+	}
+
+	EXPECT_NEAR(per_sample.integral_dt(), block.integral_dt(), 1e-7f);
+
+	const Vector3f coning_per_sample = per_sample.accumulated_coning_corrections();
+	const Vector3f coning_block = block.accumulated_coning_corrections();
+	EXPECT_GT(coning_per_sample.norm(), 0.f);
+
+	Vector3f integral_per_sample;
+	Vector3f integral_block;
+	uint32_t integral_dt_per_sample = 0;
+	uint32_t integral_dt_block = 0;
+
+	ASSERT_TRUE(per_sample.reset(integral_per_sample, integral_dt_per_sample));
+	ASSERT_TRUE(block.reset(integral_block, integral_dt_block));
+
+	EXPECT_EQ(integral_dt_per_sample, integral_dt_block);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_FLOAT_EQ(integral_per_sample(i), integral_block(i));
+		EXPECT_FLOAT_EQ(coning_per_sample(i), coning_block(i));
+	}
+}
+
+TEST_F(IntegratorTest, BlockCountsAsSingleSample)
+{
+	IntegratorConing integrator;
+	integrator.set_reset_interval(1'000'000);
+	integrator.set_reset_samples(2);
+
+	integrator.put(sample(0), 0.f);
+	integrator.put(_x, _y, _z, SAMPLES, SCALE, SAMPLES * DT_SAMPLE);
+	EXPECT_FALSE(integrator.integral_ready());
+
+	integrator.put(_x, _y, _z, SAMPLES, SCALE, SAMPLES * DT_SAMPLE);
+	EXPECT_TRUE(integrator.integral_ready());
+}
+
+TEST_F(IntegratorTest, ScullingBlockMatchesSamples)
+{
+	IntegratorSculling per_sample;
+	IntegratorSculling block;
+
+	const Vector3f angular_velocity{1.f, -2.f, 0.5f};
+
+	per_sample.put(sample(SAMPLES - 1), angular_velocity, 0.f);
+	block.put(sample(SAMPLES - 1), angular_velocity, 0.f);
+
+	for (int i = 0; i < 3; i++) {
+		for (int n = 0; n < SAMPLES; n++) {
+			per_sample.put(sample(n), angular_velocity, DT_SAMPLE);
+		}
+
+		block.put(_x, _y, _z, SAMPLES, SCALE, angular_velocity, SAMPLES * DT_SAMPLE);
+	}
+
+	const Vector3f sculling_per_sample = per_sample.accumulated_sculling_corrections();
+	const Vector3f sculling_block = block.accumulated_sculling_corrections();
+	EXPECT_GT(sculling_per_sample.norm(), 0.f);
+
+	Vector3f integral_per_sample;
+	Vector3f integral_block;
+	uint32_t integral_dt_per_sample = 0;
+	uint32_t integral_dt_block = 0;
+
+	ASSERT_TRUE(per_sample.reset(integral_per_sample, integral_dt_per_sample));
+	ASSERT_TRUE(block.reset(integral_block, integral_dt_block));
+
+	EXPECT_EQ(integral_dt_per_sample, integral_dt_block);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_FLOAT_EQ(integral_per_sample(i), integral_block(i));
+		EXPECT_FLOAT_EQ(sculling_per_sample(i), sculling_block(i));
+	}
+}
+
+TEST(IntegratorScullingTest, ScullingMotion)
+{
+	// angular oscillation about X in phase with a linear oscillation along Y: the body frame delta velocity
+	// averages out, but the velocity in a non-rotating frame builds up along Z
+	const float amplitude_angle = 0.05f;        // rad
+	const float amplitude_acceleration = 10.f;  // m/s^2
+	const float omega = 2.f * M_PI_F * 50.f;    // 50 Hz vibration
+	const float dt = 1e-3f;                     // 1 kHz samples
+	const int samples = 20;
+
+	IntegratorSculling integrator;
+	integrator.set_reset_interval(1'000'000);
+	integrator.set_reset_samples(UINT8_MAX);
+
+	integrator.put(Vector3f{0.f, 0.f, 0.f}, Vector3f{amplitude_angle * omega, 0.f, 0.f}, 0.f);
+
+	for (int n = 1; n <= samples; n++) {
+		const float t = n * dt;
+		const Vector3f acceleration{0.f, amplitude_acceleration * sinf(omega * t), 0.f};
+		const Vector3f angular_velocity{amplitude_angle * omega * cosf(omega * t), 0.f, 0.f};
+		integrator.put(acceleration, angular_velocity, dt);
+	}
+
+	// reference: integrate the acceleration rotated into the start frame with a much finer step
+	const int substeps = 1000;
+	const float dt_fine = samples * dt / substeps;
+	float delta_velocity_z = 0.f;
+
+	for (int i = 0; i < substeps; i++) {
+		const float t = (i + 0.5f) * dt_fine;
+		const float angle = amplitude_angle * sinf(omega * t);
+		delta_velocity_z += sinf(angle) * amplitude_acceleration * sinf(omega * t) * dt_fine;
+	}
+
+	ASSERT_GT(delta_velocity_z, 1e-3f);
+
+	const float sculling_z = integrator.accumulated_sculling_corrections()(2);
+
+	Vector3f integral;
+	uint32_t integral_dt = 0;
+	integrator.set_reset_samples(1);
+	ASSERT_TRUE(integrator.reset(integral, integral_dt));
+
+	// exactly one vibration period, so the angle is back at 0 and the consumer rotation compensation
+	// (0.5 * theta x v) doesn't contribute: the rectified velocity comes from the sculling correction alone
+	EXPECT_LT(fabsf(integral(2) - sculling_z), 0.1f * delta_velocity_z);
+	EXPECT_NEAR(integral(2), delta_velocity_z, 0.1f * delta_velocity_z);
+}
@@ -45,64 +45,37 @@
 
 #include <float.h>
 
-DataValidatorGroup::DataValidatorGroup(unsigned siblings)
+DataValidatorGroup::DataValidatorGroup(unsigned siblings, unsigned max_validators)
 {
-
-	DataValidator *next = nullptr;
-	DataValidator *prev = nullptr;
-
-	for (unsigned i = 0; i < siblings; i++) {
-		next = new DataValidator();
-
-		if (i == 0) {
-			_first = next;
-
-		} else {
-			prev->setSibling(next);
-		}
-
-		prev = next;
+	if (max_validators > MAX_VALIDATORS) {
+		max_validators = MAX_VALIDATORS;
 	}
 
-	_last = next;
+	_validators = new DataValidator[max_validators];
 
-	if (_first) {
-		_timeout_interval_us = _first->get_timeout();
+	if (_validators != nullptr) {
+		_max_validators = max_validators;
+		_validator_count = siblings < max_validators ? siblings : max_validators;
 	}
-}
 
-DataValidatorGroup::~DataValidatorGroup()
-{
-	while (_first) {
-		DataValidator *next = _first->sibling();
-		delete (_first);
-		_first = next;
-	}
+	_timeout_interval_us = DataValidator().get_timeout();
 }
 
 DataValidator *DataValidatorGroup::add_new_validator()
 {
-
-	DataValidator *validator = new DataValidator();
-
-	if (!validator) {
+	if (_validator_count >= _max_validators) {
 		return nullptr;
 	}
 
-	_last->setSibling(validator);
-	_last = validator;
-	_last->set_timeout(_timeout_interval_us);
-	return _last;
+	DataValidator *validator = &_validators[_validator_count++];
+	validator->set_timeout(_timeout_interval_us);
+	return validator;
 }
 
 void DataValidatorGroup::set_timeout(uint32_t timeout_interval_us)
 {
-
-	DataValidator *next = _first;
-
-	while (next != nullptr) {
-		next->set_timeout(timeout_interval_us);
-		next = next->sibling();
+	for (unsigned i = 0; i < _validator_count; i++) {
+		_validators[i].set_timeout(timeout_interval_us);
 	}
 
 	_timeout_interval_us = timeout_interval_us;
@@ -110,40 +83,23 @@ void DataValidatorGroup::set_timeout(uint32_t timeout_interval_us)
 
 void DataValidatorGroup::set_equal_value_threshold(uint32_t threshold)
 {
-
-	DataValidator *next = _first;
-
-	while (next != nullptr) {
-		next->set_equal_value_threshold(threshold);
-		next = next->sibling();
+	for (unsigned i = 0; i < _validator_count; i++) {
+		_validators[i].set_equal_value_threshold(threshold);
 	}
 }
 
 void DataValidatorGroup::put(unsigned index, uint64_t timestamp, const float val[3], uint32_t error_count,
 			     uint8_t priority)
 {
-
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (i == index) {
-			next->put(timestamp, val, error_count, priority);
-			break;
-		}
-
-		next = next->sibling();
-		i++;
+	if (index < _validator_count) {
+		_validators[index].put(timestamp, val, error_count, priority);
 	}
 }
 
 float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 {
-
-	DataValidator *next = _first;
-
 	// XXX This should eventually also include voting
-	int pre_check_best = _curr_best;
+	const int pre_check_best = _curr_best;
 	float pre_check_confidence = 1.0f;
 	int pre_check_prio = -1;
 	float max_confidence = -1.0f;
@@ -151,51 +107,41 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 	int max_index = -1;
 	DataValidator *best = nullptr;
 
-	int i = 0;
-
-	// First find the current selected sensor
-	while (next != nullptr) {
-		if (i == pre_check_best) {
-			const int prio = next->priority();
-			const float confidence = next->confidence(timestamp);
+	// evaluate the confidence of every validator exactly once
+	float confidence[MAX_VALIDATORS];
 
-			pre_check_prio = prio;
-			pre_check_confidence = confidence;
+	for (unsigned i = 0; i < _validator_count; i++) {
+		confidence[i] = _validators[i].confidence(timestamp);
+	}
 
-			max_index = i;
-			max_confidence = confidence;
-			max_priority = prio;
-			best = next;
-			break;
-		}
+	// start from the currently selected sensor
+	if ((pre_check_best >= 0) && ((unsigned)pre_check_best < _validator_count)) {
+		pre_check_prio = _validators[pre_check_best].priority();
+		pre_check_confidence = confidence[pre_check_best];
 
-		next = next->sibling();
-		i++;
+		max_index = pre_check_best;
+		max_confidence = pre_check_confidence;
+		max_priority = pre_check_prio;
+		best = &_validators[pre_check_best];
 	}
 
-	i = 0;
-	next = _first;
-
-	while (next != nullptr) {
-		float confidence = next->confidence(timestamp);
+	for (unsigned i = 0; i < _validator_count; i++) {
+		const int prio = _validators[i].priority();
 
 		/*
 		 * Switch if:
 		 * 1) the confidence is higher and priority is equal or higher
 		 * 2) the confidence is less than 1% different and the priority is higher
 		 */
-		if ((((max_confidence < MIN_REGULAR_CONFIDENCE) && (confidence >= MIN_REGULAR_CONFIDENCE)) ||
-		     (confidence > max_confidence && (next->priority() >= max_priority)) ||
-		     (fabsf(confidence - max_confidence) < 0.01f && (next->priority() > max_priority))) &&
-		    (confidence > 0.0f)) {
+		if ((((max_confidence < MIN_REGULAR_CONFIDENCE) && (confidence[i] >= MIN_REGULAR_CONFIDENCE)) ||
+		     (confidence[i] > max_confidence && (prio >= max_priority)) ||
+		     (fabsf(confidence[i] - max_confidence) < 0.01f && (prio > max_priority))) &&
+		    (confidence[i] > 0.0f)) {
 			max_index = i;
-			max_confidence = confidence;
-			max_priority = next->priority();
-			best = next;
+			max_confidence = confidence[i];
+			max_priority = prio;
+			best = &_validators[i];
 		}
-
-		next = next->sibling();
-		i++;
 	}
 
 	/* the current best sensor is not matching the previous best sensor,
@@ -250,14 +196,13 @@ void DataValidatorGroup::print()
 	PX4_INFO_RAW("validator: best: %d, prev best: %d, failsafe: %s (%u events)\n", _curr_best, _prev_best,
 		     (_toggle_count > 0) ? "YES" : "NO", _toggle_count);
 
-	DataValidator *next = _first;
-	unsigned i = 0;
+	for (unsigned i = 0; i < _validator_count; i++) {
+		DataValidator &validator = _validators[i];
 
-	while (next != nullptr) {
-		if (next->used()) {
-			uint32_t flags = next->state();
+		if (validator.used()) {
+			uint32_t flags = validator.state();
 
-			PX4_INFO_RAW("sensor #%u, prio: %d, state:%s%s%s%s%s%s\n", i, next->priority(),
+			PX4_INFO_RAW("sensor #%u, prio: %d, state:%s%s%s%s%s%s\n", i, validator.priority(),
 				     ((flags & DataValidator::ERROR_FLAG_NO_DATA) ? " OFF" : ""),
 				     ((flags & DataValidator::ERROR_FLAG_STALE_DATA) ? " STALE" : ""),
 				     ((flags & DataValidator::ERROR_FLAG_TIMEOUT) ? " TOUT" : ""),
@@ -265,27 +210,19 @@ void DataValidatorGroup::print()
 				     ((flags & DataValidator::ERROR_FLAG_HIGH_ERRDENSITY) ? " EDNST" : ""),
 				     ((flags == DataValidator::ERROR_FLAG_NO_ERROR) ? " OK" : ""));
 
-			next->print();
+			validator.print();
 		}
-
-		next = next->sibling();
-		i++;
 	}
 }
 
 int DataValidatorGroup::failover_index()
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
+	if ((_prev_best >= 0) && ((unsigned)_prev_best < _validator_count)) {
+		const DataValidator &validator = _validators[_prev_best];
 
-	while (next != nullptr) {
-		if (next->used() && (next->state() != DataValidator::ERROR_FLAG_NO_ERROR) &&
-		    (i == (unsigned)_prev_best)) {
-			return i;
+		if (validator.used() && (validator.state() != DataValidator::ERROR_FLAG_NO_ERROR)) {
+			return _prev_best;
 		}
-
-		next = next->sibling();
-		i++;
 	}
 
 	return -1;
@@ -293,18 +230,12 @@ int DataValidatorGroup::failover_index()
 
 uint32_t DataValidatorGroup::failover_state()
 {
+	if ((_prev_best >= 0) && ((unsigned)_prev_best < _validator_count)) {
+		const DataValidator &validator = _validators[_prev_best];
 
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (next->used() && (next->state() != DataValidator::ERROR_FLAG_NO_ERROR) &&
-		    (i == (unsigned)_prev_best)) {
-			return next->state();
+		if (validator.used() && (validator.state() != DataValidator::ERROR_FLAG_NO_ERROR)) {
+			return validator.state();
 		}
-
-		next = next->sibling();
-		i++;
 	}
 
 	return DataValidator::ERROR_FLAG_NO_ERROR;
@@ -312,16 +243,8 @@ uint32_t DataValidatorGroup::failover_state()
 
 uint32_t DataValidatorGroup::get_sensor_state(unsigned index)
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (i == index) {
-			return next->state();
-		}
-
-		next = next->sibling();
-		i++;
+	if (index < _validator_count) {
+		return _validators[index].state();
 	}
 
 	// sensor index not found
@@ -330,16 +253,8 @@ uint32_t DataValidatorGroup::get_sensor_state(unsigned index)
 
 uint8_t DataValidatorGroup::get_sensor_priority(unsigned index)
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (i == index) {
-			return next->priority();
-		}
-
-		next = next->sibling();
-		i++;
+	if (index < _validator_count) {
+		return _validators[index].priority();
 	}
 
 	// sensor index not found
@@ -46,15 +46,18 @@
 class DataValidatorGroup
 {
 public:
+	static constexpr unsigned MAX_VALIDATORS = 8;
+
 	/**
-	 * @param siblings initial number of DataValidator's. Must be > 0.
+	 * @param siblings initial number of DataValidator's. Must be > 0 and <= max_validators.
+	 * @param max_validators number of DataValidator's allocated up front, at most MAX_VALIDATORS.
 	 */
-	DataValidatorGroup(unsigned siblings);
-	~DataValidatorGroup();
+	DataValidatorGroup(unsigned siblings, unsigned max_validators);
+	~DataValidatorGroup() { delete[] _validators; }
 
 	/**
 	 * Create a new Validator (with index equal to the number of currently existing validators)
-	 * @return the newly created DataValidator or nullptr on error
+	 * @return the newly created DataValidator or nullptr if max_validators is reached
 	 */
 	DataValidator *add_new_validator();
 
@@ -132,8 +135,9 @@ public:
 	void set_equal_value_threshold(uint32_t threshold);
 
 private:
-	DataValidator *_first{nullptr}; /**< first node in the group */
-	DataValidator *_last{nullptr};  /**< last node in the group */
+	DataValidator *_validators{nullptr}; /**< contiguous validator storage, indexed by sensor index */
+	unsigned _max_validators{0}; /**< number of allocated validators */
+	unsigned _validator_count{0}; /**< number of validators in use */
 
 	uint32_t _timeout_interval_us{0}; /**< currently set timeout */
 
@@ -0,0 +1,243 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file RobustFusion.cpp
+ *
+ * Streaming robust fusion of redundant sensors
+ */
+
+#include "RobustFusion.hpp"
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+
+void RobustFusion::put(unsigned index, uint64_t timestamp, const float val[dimensions], float weight)
+{
+	if (index >= MAX_SENSORS) {
+		return;
+	}
+
+	for (unsigned axis = 0; axis < dimensions; axis++) {
+		_value[index][axis] = val[axis];
+	}
+
+	_time_last[index] = timestamp;
+	_weight[index] = weight;
+
+	if (index >= _sensor_count) {
+		_sensor_count = index + 1;
+	}
+}
+
+unsigned RobustFusion::update(uint64_t timestamp, float fused[dimensions])
+{
+	unsigned used[MAX_SENSORS];
+	unsigned num_used = 0;
+
+	for (unsigned i = 0; i < _sensor_count; i++) {
+		if ((_weight[i] > 0.f) && (_time_last[i] != 0) && (timestamp <= _time_last[i] + _timeout_interval)) {
+			used[num_used++] = i;
+		}
+	}
+
+	if (num_used == 0) {
+		return 0;
+	}
+
+	bool inlier[MAX_SENSORS];
+
+	for (unsigned k = 0; k < num_used; k++) {
+		inlier[used[k]] = true;
+	}
+
+	for (unsigned axis = 0; axis < dimensions; axis++) {
+		// offset corrected samples of this axis
+		float y[MAX_SENSORS];
+		float w[MAX_SENSORS];
+		unsigned index[MAX_SENSORS];
+		unsigned n = 0;
+
+		for (unsigned k = 0; k < num_used; k++) {
+			const unsigned i = used[k];
+
+			if (PX4_ISFINITE(_value[i][axis])) {
+				y[n] = _value[i][axis] - _offset[i][axis];
+				w[n] = _weight[i];
+				index[n] = i;
+				n++;
+			}
+		}
+
+		if (n == 0) {
+			fused[axis] = NAN;
+			continue;
+		}
+
+		// weighted median as robust starting point, and its weighted median absolute deviation as robust scale
+		float sorted_value[MAX_SENSORS];
+		float sorted_weight[MAX_SENSORS];
+
+		for (unsigned j = 0; j < n; j++) {
+			sorted_value[j] = y[j];
+			sorted_weight[j] = w[j];
+		}
+
+		const float median = weightedMedian(sorted_value, sorted_weight, n);
+
+		for (unsigned j = 0; j < n; j++) {
+			sorted_value[j] = fabsf(y[j] - median);
+			sorted_weight[j] = w[j];
+		}
+
+		const float scale = fmaxf(MAD_TO_SIGMA * weightedMedian(sorted_value, sorted_weight, n), _min_scale);
+		const float threshold = HUBER_K * scale;
+
+		// Huber M-estimate: average of the inliers, outliers are down-weighted with the inverse of their residual
+		float estimate = median;
+
+		for (int iteration = 0; iteration < IRLS_ITERATIONS; iteration++) {
+			float sum_weighted_value = 0.f;
+			float sum_weight = 0.f;
+
+			for (unsigned j = 0; j < n; j++) {
+				const float residual = fabsf(y[j] - estimate);
+				const float huber_weight = (residual <= threshold) ? w[j] : w[j] * threshold / residual;
+				sum_weighted_value += huber_weight * y[j];
+				sum_weight += huber_weight;
+			}
+
+			if (sum_weight > 0.f) {
+				estimate = sum_weighted_value / sum_weight;
+			}
+		}
+
+		fused[axis] = estimate;
+
+		// learn the offsets of the inliers towards the estimate. The corrections are zero-mean,
+		// so that offset learning does not move the fused estimate itself
+		float correction[MAX_SENSORS];
+		float correction_sum = 0.f;
+		unsigned num_learning = 0;
+
+		for (unsigned j = 0; j < n; j++) {
+			const float residual = y[j] - estimate;
+
+			if (fabsf(residual) <= threshold) {
+				correction[j] = _offset_learning_rate * residual;
+				correction_sum += correction[j];
+				num_learning++;
+
+			} else {
+				correction[j] = NAN;
+				inlier[index[j]] = false;
+			}
+		}
+
+		if (num_learning > 1) {
+			const float correction_mean = correction_sum / num_learning;
+
+			for (unsigned j = 0; j < n; j++) {
+				if (PX4_ISFINITE(correction[j])) {
+					_offset[index[j]][axis] += correction[j] - correction_mean;
+				}
+			}
+		}
+	}
+
+	for (unsigned k = 0; k < num_used; k++) {
+		const unsigned i = used[k];
+		_inlier_ratio[i] = 0.99f * _inlier_ratio[i] + 0.01f * (inlier[i] ? 1.f : 0.f);
+	}
+
+	return num_used;
+}
+
+void RobustFusion::reset_offsets()
+{
+	for (unsigned i = 0; i < MAX_SENSORS; i++) {
+		for (unsigned axis = 0; axis < dimensions; axis++) {
+			_offset[i][axis] = 0.f;
+		}
+	}
+}
+
+float RobustFusion::weightedMedian(float value[], float weight[], unsigned n)
+{
+	float total_weight = 0.f;
+
+	// insertion sort, n is small
+	for (unsigned i = 0; i < n; i++) {
+		const float v = value[i];
+		const float w = weight[i];
+		unsigned j = i;
+
+		while ((j > 0) && (value[j - 1] > v)) {
+			value[j] = value[j - 1];
+			weight[j] = weight[j - 1];
+			j--;
+		}
+
+		value[j] = v;
+		weight[j] = w;
+		total_weight += w;
+	}
+
+	const float half_weight = 0.5f * total_weight;
+	float cumulative_weight = 0.f;
+
+	for (unsigned i = 0; i < n; i++) {
+		cumulative_weight += weight[i];
+
+		if (cumulative_weight >= half_weight) {
+			// exactly half of the weight below: average with the next value (e.g. two equally weighted sensors)
+			if ((i + 1 < n) && (cumulative_weight - half_weight <= 1.e-6f * total_weight)) {
+				return 0.5f * (value[i] + value[i + 1]);
+			}
+
+			return value[i];
+		}
+	}
+
+	return value[n - 1];
+}
+
+void RobustFusion::print() const
+{
+	for (unsigned i = 0; i < _sensor_count; i++) {
+		if (_time_last[i] != 0) {
+			PX4_INFO_RAW("sensor #%u, weight: %.2f, inlier ratio: %.2f, offset: %.4f %.4f %.4f\n", i, (double)_weight[i],
+				     (double)_inlier_ratio[i], (double)_offset[i][0], (double)_offset[i][1], (double)_offset[i][2]);
+		}
+	}
+}
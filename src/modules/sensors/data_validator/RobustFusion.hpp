@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file RobustFusion.hpp
+ *
+ * Streaming robust fusion of redundant sensors: weighted median initialization,
+ * Huber M-estimator refinement and per-sensor offset learning
+ */
+
+#pragma once
+
+#include "DataValidator.hpp"
+#include "DataValidatorGroup.hpp"
+
+#include <stdint.h>
+
+class RobustFusion
+{
+public:
+	static constexpr unsigned dimensions = DataValidator::dimensions;
+	static constexpr unsigned MAX_SENSORS = DataValidatorGroup::MAX_VALIDATORS;
+
+	RobustFusion() = default;
+	~RobustFusion() = default;
+
+	/**
+	 * Store the latest sample of a sensor.
+	 *
+	 * @param index		Sensor index
+	 * @param timestamp	The timestamp of the measurement
+	 * @param val		The 3D vector
+	 * @param weight	Relative weight of the sensor, a weight <= 0 excludes the sensor
+	 */
+	void put(unsigned index, uint64_t timestamp, const float val[dimensions], float weight);
+
+	/**
+	 * Fuse the latest samples of all sensors that did not time out and update the per-sensor offsets.
+	 *
+	 * @param timestamp	Current time
+	 * @param fused		(out) fused estimate, only written if at least one sensor was used
+	 * @return		number of sensors used, 0 if there is no estimate
+	 */
+	unsigned update(uint64_t timestamp, float fused[dimensions]);
+
+	/**
+	 * Get the learned offset of a sensor (subtracted from its samples before fusion)
+	 */
+	const float *offset(unsigned index) const { return _offset[index]; }
+
+	/**
+	 * Get the fraction of updates in which the sensor was an inlier (low-pass filtered)
+	 */
+	float inlier_ratio(unsigned index) const { return _inlier_ratio[index]; }
+
+	/**
+	 * Forget all learned offsets
+	 */
+	void reset_offsets();
+
+	/**
+	 * Set the timeout value
+	 *
+	 * @param timeout_interval_us Samples older than this are not used
+	 */
+	void set_timeout(uint32_t timeout_interval_us) { _timeout_interval = timeout_interval_us; }
+
+	/**
+	 * Set the offset learning rate
+	 *
+	 * @param rate Fraction of the residual learned per update (0 disables offset learning)
+	 */
+	void set_offset_learning_rate(float rate) { _offset_learning_rate = rate; }
+
+	/**
+	 * Set the lower bound of the robust scale, in data units
+	 *
+	 * Residuals within HUBER_K times this bound are never down-weighted, so that sensors agreeing
+	 * within their noise level are averaged.
+	 */
+	void set_min_scale(float min_scale) { _min_scale = min_scale; }
+
+	/**
+	 * Print the fusion state
+	 */
+	void print() const;
+
+private:
+	/**
+	 * Weighted median of n (value, weight) pairs. Sorts the arrays in place.
+	 */
+	static float weightedMedian(float value[], float weight[], unsigned n);
+
+	static constexpr float HUBER_K = 1.345f;       /**< Huber threshold in robust standard deviations (95% efficiency) */
+	static constexpr float MAD_TO_SIGMA = 1.4826f; /**< median absolute deviation to standard deviation */
+	static constexpr int IRLS_ITERATIONS = 2;      /**< iteratively reweighted least squares steps */
+
+	float _value[MAX_SENSORS][dimensions] {};  /**< latest sample */
+	float _offset[MAX_SENSORS][dimensions] {}; /**< learned offset */
+	uint64_t _time_last[MAX_SENSORS] {};       /**< timestamp of the latest sample */
+	float _weight[MAX_SENSORS] {};             /**< relative weight */
+	float _inlier_ratio[MAX_SENSORS] {};       /**< low-pass filtered inlier flag */
+	unsigned _sensor_count{0};                 /**< highest sensor index + 1 */
+
+	uint32_t _timeout_interval{300000};  /**< interval in which a sample times out in us */
+	float _offset_learning_rate{0.001f}; /**< fraction of the residual learned per update */
+	float _min_scale{1.e-3f};            /**< lower bound of the robust scale */
+
+	/* we don't want this class to be copied */
+	RobustFusion(const RobustFusion &) = delete;
+	RobustFusion operator=(const RobustFusion &) = delete;
+};
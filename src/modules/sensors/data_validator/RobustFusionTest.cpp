@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the RobustFusion class
+ * Run this test only using make tests TESTFILTER=RobustFusion
+ */
+
+#include <gtest/gtest.h>
+
+#include "RobustFusion.hpp"
+
+TEST(RobustFusionTest, Empty)
+{
+	RobustFusion fusion;
+	float fused[RobustFusion::dimensions] = {1.f, 2.f, 3.f};
+
+	// no sensors, no estimate and the output is untouched
+	EXPECT_EQ(0, fusion.update(1000, fused));
+	EXPECT_EQ(1.f, fused[0]);
+
+	// excluded sensor
+	float data[RobustFusion::dimensions] = {5.f};
+	fusion.put(0, 1000, data, 0.f);
+	EXPECT_EQ(0, fusion.update(1000, fused));
+}
+
+TEST(RobustFusionTest, OutlierRejection)
+{
+	RobustFusion fusion;
+	fusion.set_offset_learning_rate(0.f);
+	fusion.set_min_scale(0.01f);
+
+	const uint64_t timestamp = 1000;
+	float data0[RobustFusion::dimensions] = {10.00f, -1.f, 0.f};
+	float data1[RobustFusion::dimensions] = {10.02f, -1.f, 0.f};
+	float data2[RobustFusion::dimensions] = {10.01f, -1.f, 0.f};
+	float data3[RobustFusion::dimensions] = {50.00f, -1.f, 0.f}; // faulty
+
+	fusion.put(0, timestamp, data0, 1.f);
+	fusion.put(1, timestamp, data1, 1.f);
+	fusion.put(2, timestamp, data2, 1.f);
+	fusion.put(3, timestamp, data3, 1.f);
+
+	float fused[RobustFusion::dimensions] {};
+	EXPECT_EQ(4, fusion.update(timestamp, fused));
+
+	// the faulty sensor barely influences the estimate, the others are averaged
+	EXPECT_NEAR(fused[0], 10.01f, 0.02f);
+	EXPECT_NEAR(fused[1], -1.f, 1e-6f);
+}
+
+TEST(RobustFusionTest, Timeout)
+{
+	RobustFusion fusion;
+	fusion.set_timeout(100);
+	fusion.set_offset_learning_rate(0.f);
+
+	float data0[RobustFusion::dimensions] = {1.f};
+	float data1[RobustFusion::dimensions] = {3.f};
+
+	fusion.put(0, 1000, data0, 1.f);
+	fusion.put(1, 1050, data1, 1.f);
+
+	float fused[RobustFusion::dimensions] {};
+
+	// two equally weighted sensors: the median is the average
+	EXPECT_EQ(2, fusion.update(1090, fused));
+	EXPECT_NEAR(fused[0], 2.f, 1e-6f);
+
+	// sensor 0 timed out
+	EXPECT_EQ(1, fusion.update(1120, fused));
+	EXPECT_NEAR(fused[0], 3.f, 1e-6f);
+
+	// all timed out
+	EXPECT_EQ(0, fusion.update(2000, fused));
+}
+
+TEST(RobustFusionTest, OffsetLearning)
+{
+	RobustFusion fusion;
+	fusion.set_offset_learning_rate(0.01f);
+	fusion.set_min_scale(1.f);
+
+	// three sensors with constant offsets and some alternating noise
+	const float truth = 100.f;
+	const float bias[3] = {0.5f, 0.f, -0.2f};
+
+	uint64_t timestamp = 1000;
+	float fused[RobustFusion::dimensions] {};
+
+	for (int i = 0; i < 2000; i++) {
+		timestamp += 1000;
+
+		for (unsigned sensor = 0; sensor < 3; sensor++) {
+			const float noise = ((i + sensor) % 2 == 0) ? 0.01f : -0.01f;
+			float data[RobustFusion::dimensions] = {truth + bias[sensor] + noise};
+			fusion.put(sensor, timestamp, data, 1.f);
+		}
+
+		ASSERT_EQ(3, fusion.update(timestamp, fused));
+	}
+
+	// offsets are learned relative to the mean bias, so they sum to zero
+	const float bias_mean = (bias[0] + bias[1] + bias[2]) / 3.f;
+
+	for (unsigned sensor = 0; sensor < 3; sensor++) {
+		EXPECT_NEAR(fusion.offset(sensor)[0], bias[sensor] - bias_mean, 0.02f);
+		EXPECT_GT(fusion.inlier_ratio(sensor), 0.9f);
+	}
+
+	const float fused_all = fused[0];
+	EXPECT_NEAR(fused_all, truth + bias_mean, 0.02f);
+
+	// losing a sensor does not cause a step in the fused estimate
+	timestamp += 1000;
+	float data[RobustFusion::dimensions] = {truth + bias[1]};
+	fusion.put(1, timestamp, data, 1.f);
+	data[0] = truth + bias[2];
+	fusion.put(2, timestamp, data, 1.f);
+	fusion.put(0, 0, data, 0.f); // sensor 0 excluded
+
+	EXPECT_EQ(2, fusion.update(timestamp, fused));
+	EXPECT_NEAR(fused[0], fused_all, 0.02f);
+
+	fusion.reset_offsets();
+	EXPECT_EQ(0.f, fusion.offset(0)[0]);
+}
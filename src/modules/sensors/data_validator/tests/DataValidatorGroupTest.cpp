@@ -31,20 +31,19 @@
  *
  ****************************************************************************/
 /**
- * @file test_data_validator_group.cpp
+ * @file DataValidatorGroupTest.cpp
  * Testing the DataValidatorGroup class
  *
  * @author Todd Stellanova
  */
 
+#include <gtest/gtest.h>
+
 #include <stdint.h>
-#include <cassert>
-#include <cstdlib>
-#include <stdio.h>
-#include <math.h>
-#include <validation/data_validator.h>
-#include <validation/data_validator_group.h>
-#include <validation/tests/tests_common.h>
+#include <stdlib.h>
+
+#include "tests_common.h"
+#include "../DataValidatorGroup.hpp"
 
 
 const uint32_t base_timeout_usec = 2000;//from original private value
@@ -61,16 +60,14 @@ DataValidatorGroup  *setup_base_group(unsigned *sibling_count)
 {
 	unsigned num_siblings = base_num_siblings;
 
-	DataValidatorGroup *group = new DataValidatorGroup(num_siblings);
-	assert(nullptr != group);
+	DataValidatorGroup *group = new DataValidatorGroup(num_siblings, DataValidatorGroup::MAX_VALIDATORS);
 	//verify that calling print doesn't crash the tests
 	group->print();
-	printf("\n");
 
 	//should be no failovers yet
-	assert(0 == group->failover_count());
-	assert(DataValidator::ERROR_FLAG_NO_ERROR == group->failover_state());
-	assert(-1 == group->failover_index());
+	EXPECT_EQ(0u, group->failover_count());
+	EXPECT_EQ(DataValidator::ERROR_FLAG_NO_ERROR, group->failover_state());
+	EXPECT_EQ(-1, group->failover_index());
 
 	//this sets the timeout on all current members of the group, as well as members added later
 	group->set_timeout(base_timeout_usec);
@@ -84,34 +81,6 @@ DataValidatorGroup  *setup_base_group(unsigned *sibling_count)
 	return group;
 }
 
-/**
- * Fill one DataValidator with samples, by index.
- *
- * @param group
- * @param val1_idx Index of the validator to fill with samples
- * @param num_samples
- */
-void fill_one_with_valid_data(DataValidatorGroup *group, int val1_idx,  uint32_t num_samples)
-{
-	uint64_t timestamp = base_timestamp;
-	uint32_t error_count = 0;
-	float last_best_val = 0.0f;
-
-	for (uint32_t i = 0; i < num_samples; i++) {
-		float val = ((float) rand() / (float) RAND_MAX);
-		float data[DataValidator::dimensions] = {val};
-		group->put(val1_idx, timestamp, data, error_count, 100);
-		last_best_val = val;
-	}
-
-	int best_idx = 0;
-	float *best_data = group->get_best(timestamp, &best_idx);
-	assert(last_best_val == best_data[0]);
-	assert(best_idx == val1_idx);
-}
-
-
-
 /**
  * Fill two validators in the group with samples, by index.
  * Both validators will be filled with the same data, but
@@ -139,9 +108,9 @@ void fill_two_with_valid_data(DataValidatorGroup *group, int val1_idx, int val2_
 
 	int best_idx = 0;
 	float *best_data = group->get_best(timestamp, &best_idx);
-	assert(last_best_val == best_data[0]);
-	assert(best_idx == val1_idx);
-
+	ASSERT_NE(nullptr, best_data);
+	EXPECT_EQ(last_best_val, best_data[0]);
+	EXPECT_EQ(val1_idx, best_idx);
 }
 
 /**
@@ -152,11 +121,14 @@ void fill_two_with_valid_data(DataValidatorGroup *group, int val1_idx, int val2_
 DataValidator *add_validator_to_group(DataValidatorGroup *group)
 {
 	DataValidator *validator = group->add_new_validator();
-	//verify the previously set timeout applies to the new group member
-	assert(validator->get_timeout() == base_timeout_usec);
-	//for testing purposes, ensure this newly added member is consistent with the rest of the group
-	//TODO this is likely a bug in DataValidatorGroup
-	validator->set_equal_value_threshold(equal_value_count);
+
+	if (validator != nullptr) {
+		//verify the previously set timeout applies to the new group member
+		EXPECT_EQ(base_timeout_usec, validator->get_timeout());
+		//for testing purposes, ensure this newly added member is consistent with the rest of the group
+		//TODO this is likely a bug in DataValidatorGroup
+		validator->set_equal_value_threshold(equal_value_count);
+	}
 
 	return validator;
 }
@@ -185,7 +157,7 @@ DataValidatorGroup *setup_group_with_two_validator_handles(
 }
 
 
-void test_init()
+TEST(DataValidatorGroupTest, Init)
 {
 	unsigned num_siblings = 0;
 
@@ -193,16 +165,39 @@ void test_init()
 
 	//should not yet be any best value
 	int best_index = -1;
-	assert(nullptr == group->get_best(base_timestamp, &best_index));
+	EXPECT_EQ(nullptr, group->get_best(base_timestamp, &best_index));
 
 	delete group; //force cleanup
 }
 
+/**
+ * The validators are allocated up front, adding more than max_validators must fail
+ */
+TEST(DataValidatorGroupTest, Capacity)
+{
+	DataValidatorGroup group(1, 3);
+	group.set_timeout(base_timeout_usec);
+
+	EXPECT_NE(nullptr, add_validator_to_group(&group));
+	EXPECT_NE(nullptr, add_validator_to_group(&group));
+	EXPECT_EQ(nullptr, add_validator_to_group(&group));
+
+	// put() to an index outside of the group is ignored
+	float data[DataValidator::dimensions] = {1.f};
+	group.put(3, base_timestamp, data, 0, 100);
+	EXPECT_EQ(UINT32_MAX, group.get_sensor_state(3));
+	EXPECT_EQ(0, group.get_sensor_priority(3));
+
+	// the requested size is capped
+	DataValidatorGroup capped(DataValidatorGroup::MAX_VALIDATORS, DataValidatorGroup::MAX_VALIDATORS + 1);
+	EXPECT_EQ(nullptr, capped.add_new_validator());
+}
+
 
 /**
  * Happy path test of put method -- ensure the "best" sensor selected is the one with highest priority
  */
-void test_put()
+TEST(DataValidatorGroupTest, Put)
 {
 	unsigned num_siblings = 0;
 	DataValidator *validator1 = nullptr;
@@ -211,25 +206,24 @@ void test_put()
 	uint64_t timestamp = base_timestamp;
 
 	DataValidatorGroup *group = setup_group_with_two_validator_handles(&validator1, &validator2, &num_siblings);
-	printf("num_siblings: %d \n", num_siblings);
+	ASSERT_NE(nullptr, validator1);
+	ASSERT_NE(nullptr, validator2);
 	unsigned val1_idx = num_siblings - 2;
 	unsigned val2_idx = num_siblings - 1;
 
 	fill_two_with_valid_data(group, val1_idx, val2_idx, 500);
 	int best_idx = -1;
 	float *best_data = group->get_best(timestamp, &best_idx);
-	assert(nullptr != best_data);
+	ASSERT_NE(nullptr, best_data);
 	float best_val = best_data[0];
 
 	float *cur_val1 = validator1->value();
-	assert(nullptr != cur_val1);
-	//printf("cur_val1 %p \n", cur_val1);
-	assert(best_val == cur_val1[0]);
+	ASSERT_NE(nullptr, cur_val1);
+	EXPECT_EQ(best_val, cur_val1[0]);
 
 	float *cur_val2 = validator2->value();
-	assert(nullptr != cur_val2);
-	//printf("cur_val12 %p \n", cur_val2);
-	assert(best_val == cur_val2[0]);
+	ASSERT_NE(nullptr, cur_val2);
+	EXPECT_EQ(best_val, cur_val2[0]);
 
 	delete group; //force cleanup
 }
@@ -238,7 +232,7 @@ void test_put()
 /**
  * Verify that the DataValidatorGroup will select the sensor with the latest higher priority as "best".
  */
-void test_priority_switch()
+TEST(DataValidatorGroupTest, PrioritySwitch)
 {
 	unsigned num_siblings = 0;
 	DataValidator *validator1 = nullptr;
@@ -247,7 +241,6 @@ void test_priority_switch()
 	uint64_t timestamp = base_timestamp;
 
 	DataValidatorGroup *group = setup_group_with_two_validator_handles(&validator1, &validator2, &num_siblings);
-	//printf("num_siblings: %d \n",num_siblings);
 	int val1_idx = (int)num_siblings - 2;
 	int val2_idx = (int)num_siblings - 1;
 	uint32_t error_count = 0;
@@ -263,11 +256,12 @@ void test_priority_switch()
 	group->put(val1_idx, timestamp, data, error_count, 1);
 	group->put(val2_idx, timestamp, data, error_count, 100);
 	best_data = group->get_best(timestamp, &best_idx);
-	assert(new_best_val == best_data[0]);
+	ASSERT_NE(nullptr, best_data);
+	EXPECT_EQ(new_best_val, best_data[0]);
 	//the new best sensor should now be the sensor with the higher priority
-	assert(best_idx == val2_idx);
+	EXPECT_EQ(val2_idx, best_idx);
 	//should not have detected a real failover
-	assert(0 == group->failover_count());
+	EXPECT_EQ(0u, group->failover_count());
 
 	delete  group; //cleanup
 }
@@ -275,7 +269,7 @@ void test_priority_switch()
 /**
  * Verify that the DataGroupValidator will prefer a sensor with no errors over a sensor with high errors
  */
-void test_simple_failover()
+TEST(DataValidatorGroupTest, SimpleFailover)
 {
 	unsigned num_siblings = 0;
 	DataValidator *validator1 = nullptr;
@@ -284,7 +278,7 @@ void test_simple_failover()
 	uint64_t timestamp = base_timestamp;
 
 	DataValidatorGroup *group = setup_group_with_two_validator_handles(&validator1, &validator2, &num_siblings);
-	//printf("num_siblings: %d \n",num_siblings);
+	ASSERT_NE(nullptr, validator1);
 	int val1_idx = (int)num_siblings - 2;
 	int val2_idx = (int)num_siblings - 1;
 
@@ -305,26 +299,24 @@ void test_simple_failover()
 		group->put(val2_idx, timestamp, data, 0, 10);
 	}
 
-	assert(validator1->error_count() == val1_err_count);
+	EXPECT_EQ(val1_err_count, validator1->error_count());
 
 	//since validator1 is experiencing errors, we should see a failover to validator2
 	best_data = group->get_best(timestamp + 1, &best_idx);
-	assert(nullptr != best_data);
-	assert(new_best_val == best_data[0]);
-	assert(best_idx == val2_idx);
+	ASSERT_NE(nullptr, best_data);
+	EXPECT_EQ(new_best_val, best_data[0]);
+	EXPECT_EQ(val2_idx, best_idx);
 	//should have detected a real failover
-	printf("failover_count: %d \n", group->failover_count());
-	assert(1 == group->failover_count());
+	EXPECT_EQ(1u, group->failover_count());
 
 	//even though validator1 has encountered a bunch of errors, it hasn't failed
-	assert(DataValidator::ERROR_FLAG_NO_ERROR == validator1->state());
+	EXPECT_EQ(DataValidator::ERROR_FLAG_NO_ERROR, validator1->state());
 
 	// although we failed over from one sensor to another, this is not the same thing tracked by failover_index
-	int fail_idx = group->failover_index();
-	assert(-1 == fail_idx);//no failed sensor
+	EXPECT_EQ(-1, group->failover_index());//no failed sensor
 
 	//since no sensor has actually hard-failed, the group failover state is NO_ERROR
-	assert(DataValidator::ERROR_FLAG_NO_ERROR == group->failover_state());
+	EXPECT_EQ(DataValidator::ERROR_FLAG_NO_ERROR, group->failover_state());
 
 
 	delete  group; //cleanup
@@ -333,7 +325,7 @@ void test_simple_failover()
 /**
  * Force once sensor to fail and ensure that we detect it
  */
-void test_sensor_failure()
+TEST(DataValidatorGroupTest, SensorFailure)
 {
 	unsigned num_siblings = 0;
 	uint64_t timestamp = base_timestamp;
@@ -346,7 +338,7 @@ void test_sensor_failure()
 
 	//now we add validators
 	DataValidator *validator  = add_validator_to_group(group);
-	assert(nullptr != validator);
+	ASSERT_NE(nullptr, validator);
 	num_siblings++;
 	int val_idx = num_siblings - 1;
 
@@ -355,31 +347,15 @@ void test_sensor_failure()
 
 	int best_idx = -1;
 	float *best_data = group->get_best(timestamp, &best_idx);
-	assert(nullptr != best_data);
-	//printf("best_idx: %d val_idx: %d\n", best_idx, val_idx);
-	assert(best_idx == val_idx);
+	ASSERT_NE(nullptr, best_data);
+	EXPECT_EQ(val_idx, best_idx);
 
 	//now force a timeout failure in the one validator, by checking confidence long past timeout
 	validator->confidence(timestamp + (1.1 * timeout_usec));
-	assert(DataValidator::ERROR_FLAG_TIMEOUT == (DataValidator::ERROR_FLAG_TIMEOUT & validator->state()));
+	EXPECT_EQ(DataValidator::ERROR_FLAG_TIMEOUT, (DataValidator::ERROR_FLAG_TIMEOUT & validator->state()));
 
 	//now that the one sensor has failed, the group should detect this as well
-	int fail_idx = group->failover_index();
-	assert(val_idx == fail_idx);
+	EXPECT_EQ(val_idx, group->failover_index());
 
 	delete  group;
 }
-
-int main(int argc, char *argv[])
-{
-	(void)argc; // unused
-	(void)argv; // unused
-
-	test_init();
-	test_put();
-	test_simple_failover();
-	test_priority_switch();
-	test_sensor_failure();
-
-	return 0; //passed
-}
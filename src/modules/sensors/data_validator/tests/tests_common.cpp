@@ -50,7 +50,7 @@ void insert_values_around_mean(DataValidator *validator, const float mean, uint3
 		float iter_swing = (0 == (i % 2)) ? swing : -swing;
 		float iter_val = mean + iter_swing;
 		float iter_dev = iter_val - mean;
-		sum_dev_squares += (iter_dev * iter_dev);
+		sum_dev_squares += (double)(iter_dev * iter_dev);
 		timestamp += timestamp_incr;
 		validator->put(timestamp, iter_val, error_count, priority);
 	}
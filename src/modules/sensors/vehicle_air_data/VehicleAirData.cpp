@@ -48,6 +48,7 @@ static constexpr uint32_t SENSOR_TIMEOUT{300_ms};
 static constexpr float DEFAULT_TEMPERATURE_CELSIUS = 15.f;
 static constexpr float TEMPERATURE_MIN_CELSIUS = -60.f;
 static constexpr float TEMPERATURE_MAX_CELSIUS = 60.f;
+static constexpr float FUSION_MIN_SCALE_PA = 10.f; // barometers agreeing within ~1 m are averaged
 
 VehicleAirData::VehicleAirData() :
 	ModuleParams(nullptr),
@@ -56,6 +57,9 @@ VehicleAirData::VehicleAirData() :
 	_vehicle_air_data_pub.advertise();
 
 	_voter.set_timeout(SENSOR_TIMEOUT);
+
+	_fusion.set_timeout(SENSOR_TIMEOUT);
+	_fusion.set_min_scale(FUSION_MIN_SCALE_PA);
 }
 
 VehicleAirData::~VehicleAirData()
@@ -147,7 +151,10 @@ void VehicleAirData::Run()
 	estimator_status_flags_s estimator_status_flags;
 	const bool estimator_status_flags_updated = _estimator_status_flags_sub.update(&estimator_status_flags);
 
+	const bool fusion_mode = (_param_sens_baro_mode.get() == 1);
+
 	bool updated[MAX_SENSOR_COUNT] {};
+	bool any_updated = false;
 
 	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
 
@@ -215,6 +222,12 @@ void VehicleAirData::Run()
 					float data_array[3] {pressure_corrected, report.temperature, getAltitudeFromPressure(pressure_corrected, pressure_sealevel_pa)};
 					_voter.put(uorb_index, report.timestamp, data_array, report.error_count, _priority[uorb_index]);
 
+					if (fusion_mode) {
+						// only pressure is fused
+						const float fusion_data[RobustFusion::dimensions] {pressure_corrected, NAN, NAN};
+						_fusion.put(uorb_index, report.timestamp, fusion_data, _priority[uorb_index] / 100.f);
+					}
+
 					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
 					_data_sum[uorb_index] += pressure_corrected;
 					_temperature_sum[uorb_index] += report.temperature;
@@ -223,11 +236,24 @@ void VehicleAirData::Run()
 					_last_data[uorb_index] = pressure_corrected;
 
 					updated[uorb_index] = true;
+					any_updated = true;
 				}
 			}
 		}
 	}
 
+	if (fusion_mode) {
+		float fused[RobustFusion::dimensions];
+
+		if (any_updated && (_fusion.update(time_now_us, fused) > 0) && PX4_ISFINITE(fused[0])) {
+			_fused_pressure_sum += fused[0];
+			_fused_sum_count++;
+		}
+
+	} else {
+		_fused_device_id = 0;
+	}
+
 	if (estimator_status_flags_updated) {
 		_last_status_baro_fault = estimator_status_flags.cs_baro_fault;
 	}
@@ -281,7 +307,19 @@ void VehicleAirData::Run()
 					}
 
 					if (publish) {
-						const float pressure_pa = _data_sum[instance] / _data_sum_count[instance];
+						float pressure_pa = _data_sum[instance] / _data_sum_count[instance];
+						uint32_t device_id = _calibration[instance].device_id();
+
+						if (fusion_mode && (_fused_sum_count > 0)) {
+							pressure_pa = _fused_pressure_sum / _fused_sum_count;
+
+							if (_fused_device_id == 0) {
+								_fused_device_id = device_id;
+							}
+
+							device_id = _fused_device_id;
+						}
+
 						const float temperature_baro = _temperature_sum[instance] / _data_sum_count[instance];
 						TemperatureSource temperature_source = _calibration[instance].external() ? TemperatureSource::EXTERNAL_BARO :
 										       TemperatureSource::DEFAULT_TEMP;
@@ -296,7 +334,7 @@ void VehicleAirData::Run()
 						// populate vehicle_air_data with and publish
 						vehicle_air_data_s out{};
 						out.timestamp_sample = timestamp_sample;
-						out.baro_device_id = _calibration[instance].device_id();
+						out.baro_device_id = device_id;
 						out.baro_alt_meter = altitude;
 						out.ambient_temperature = ambient_temperature;
 						out.temperature_source = static_cast<uint8_t>(temperature_source);
@@ -315,6 +353,11 @@ void VehicleAirData::Run()
 					_data_sum[instance] = 0;
 					_temperature_sum[instance] = 0;
 					_data_sum_count[instance] = 0;
+
+					if (instance == _selected_sensor_sub_index) {
+						_fused_pressure_sum = 0.f;
+						_fused_sum_count = 0;
+					}
 				}
 			}
 		}
@@ -465,6 +508,11 @@ void VehicleAirData::PrintStatus()
 
 	_voter.print();
 
+	if (_param_sens_baro_mode.get() == 1) {
+		PX4_INFO_RAW("robust fusion:\n");
+		_fusion.print();
+	}
+
 	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
 		if (_advertised[i] && (_priority[i] > 0)) {
 			_calibration[i].PrintStatus();
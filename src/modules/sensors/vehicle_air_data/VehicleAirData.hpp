@@ -34,6 +34,7 @@
 #pragma once
 
 #include "data_validator/DataValidatorGroup.hpp"
+#include "data_validator/RobustFusion.hpp"
 
 #include <lib/sensor_calibration/Barometer.hpp>
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
@@ -118,9 +119,14 @@ private:
 	hrt_abstime _last_error_message{0};
 	orb_advert_t _mavlink_log_pub{nullptr};
 
-	DataValidatorGroup _voter{1};
+	DataValidatorGroup _voter{1, MAX_SENSOR_COUNT};
 	unsigned _last_failover_count{0};
 
+	RobustFusion _fusion{};
+	float _fused_pressure_sum{0.f};
+	int _fused_sum_count{0};
+	uint32_t _fused_device_id{0}; ///< published device id while fusing, latched so that a selection change is not reported as sensor switch
+
 	uint64_t _timestamp_sample_sum[MAX_SENSOR_COUNT] {0};
 	float _data_sum[MAX_SENSOR_COUNT] {};
 	float _temperature_sum[MAX_SENSOR_COUNT] {};
@@ -148,7 +154,8 @@ private:
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SENS_BARO_QNH>) _param_sens_baro_qnh,
 		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate,
-		(ParamBool<px4::params::SENS_BAR_AUTOCAL>) _param_sens_baro_autocal
+		(ParamBool<px4::params::SENS_BAR_AUTOCAL>) _param_sens_baro_autocal,
+		(ParamInt<px4::params::SENS_BARO_MODE>) _param_sens_baro_mode
 	)
 };
 }; // namespace sensors
@@ -65,3 +65,19 @@ PARAM_DEFINE_FLOAT(SENS_BARO_RATE, 20.0f);
  * @group Sensors
  */
 PARAM_DEFINE_INT32(SENS_BAR_AUTOCAL, 1);
+
+/**
+ * Barometer mode
+ *
+ * Select how multiple barometers are combined into vehicle_air_data.
+ * Robust fusion combines all barometers with a weighted median/Huber estimator
+ * and learns the relative offsets online, so that losing a sensor does not
+ * cause a step in the published pressure.
+ *
+ * @value 0 Primary barometer (failover)
+ * @value 1 Robust fusion of all barometers
+ *
+ * @category system
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_BARO_MODE, 0);
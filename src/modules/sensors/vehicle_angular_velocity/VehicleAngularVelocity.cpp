@@ -56,15 +56,18 @@ VehicleAngularVelocity::~VehicleAngularVelocity()
 	perf_free(_cycle_perf);
 	perf_free(_filter_reset_perf);
 	perf_free(_selection_changed_perf);
+	perf_free(_filter_apply_perf);
 
 #if !defined(CONSTRAINED_FLASH)
 	delete[] _dynamic_notch_filter_esc_rpm;
 	perf_free(_dynamic_notch_filter_esc_rpm_disable_perf);
 	perf_free(_dynamic_notch_filter_esc_rpm_init_perf);
 	perf_free(_dynamic_notch_filter_esc_rpm_update_perf);
+	perf_free(_dynamic_notch_filter_esc_rpm_apply_perf);
 
 	perf_free(_dynamic_notch_filter_fft_disable_perf);
 	perf_free(_dynamic_notch_filter_fft_update_perf);
+	perf_free(_dynamic_notch_filter_fft_apply_perf);
 #endif // CONSTRAINED_FLASH
 }
 
@@ -166,21 +169,21 @@ void VehicleAngularVelocity::ResetFilters(const hrt_abstime &time_now_us)
 		const Vector3f angular_velocity_uncalibrated{GetResetAngularVelocity()};
 		const Vector3f angular_acceleration_uncalibrated{GetResetAngularAcceleration()};
 
-		for (int axis = 0; axis < 3; axis++) {
-			// angular velocity low pass
-			_lp_filter_velocity[axis].set_cutoff_frequency(_filter_sample_rate_hz, _param_imu_gyro_cutoff.get());
-			_lp_filter_velocity[axis].reset(angular_velocity_uncalibrated(axis));
+		// angular velocity low pass
+		_lp_filter_velocity.set_cutoff_frequency(_filter_sample_rate_hz, _param_imu_gyro_cutoff.get());
+		_lp_filter_velocity.reset(angular_velocity_uncalibrated);
 
-			// angular velocity notch 0
-			_notch_filter0_velocity[axis].setParameters(_filter_sample_rate_hz, _param_imu_gyro_nf0_frq.get(),
-					_param_imu_gyro_nf0_bw.get());
-			_notch_filter0_velocity[axis].reset();
+		// angular velocity notch 0
+		_notch_filter0_velocity.setParameters(_filter_sample_rate_hz, _param_imu_gyro_nf0_frq.get(),
+						      _param_imu_gyro_nf0_bw.get());
+		_notch_filter0_velocity.reset();
 
-			// angular velocity notch 1
-			_notch_filter1_velocity[axis].setParameters(_filter_sample_rate_hz, _param_imu_gyro_nf1_frq.get(),
-					_param_imu_gyro_nf1_bw.get());
-			_notch_filter1_velocity[axis].reset();
+		// angular velocity notch 1
+		_notch_filter1_velocity.setParameters(_filter_sample_rate_hz, _param_imu_gyro_nf1_frq.get(),
+						      _param_imu_gyro_nf1_bw.get());
+		_notch_filter1_velocity.reset();
 
+		for (int axis = 0; axis < 3; axis++) {
 			// angular acceleration low pass
 			if ((_param_imu_dgyro_cutoff.get() > 0.f)
 			    && (_lp_filter_acceleration[axis].setCutoffFreq(_filter_sample_rate_hz, _param_imu_dgyro_cutoff.get()))) {
@@ -397,32 +400,27 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 		}
 
 		// gyro low pass cutoff frequency changed
-		for (auto &lp : _lp_filter_velocity) {
-			if (fabsf(lp.get_cutoff_freq() - _param_imu_gyro_cutoff.get()) > 0.01f) {
-				_reset_filters = true;
-				break;
-			}
+		if (fabsf(_lp_filter_velocity.get_cutoff_freq() - _param_imu_gyro_cutoff.get()) > 0.01f) {
+			_reset_filters = true;
 		}
 
 		// gyro notch filter 0 frequency or bandwidth changed
-		for (auto &nf : _notch_filter0_velocity) {
-			const bool nf_freq_changed = (fabsf(nf.getNotchFreq() - _param_imu_gyro_nf0_frq.get()) > 0.01f);
-			const bool nf_bw_changed   = (fabsf(nf.getBandwidth() - _param_imu_gyro_nf0_bw.get()) > 0.01f);
+		{
+			const bool nf_freq_changed = (fabsf(_notch_filter0_velocity.getNotchFreq() - _param_imu_gyro_nf0_frq.get()) > 0.01f);
+			const bool nf_bw_changed   = (fabsf(_notch_filter0_velocity.getBandwidth() - _param_imu_gyro_nf0_bw.get()) > 0.01f);
 
 			if ((nf0_enabled_prev != nf0_enabled) || (nf0_enabled && (nf_freq_changed || nf_bw_changed))) {
 				_reset_filters = true;
-				break;
 			}
 		}
 
 		// gyro notch filter 1 frequency or bandwidth changed
-		for (auto &nf : _notch_filter1_velocity) {
-			const bool nf_freq_changed = (fabsf(nf.getNotchFreq() - _param_imu_gyro_nf1_frq.get()) > 0.01f);
-			const bool nf_bw_changed   = (fabsf(nf.getBandwidth() - _param_imu_gyro_nf1_bw.get()) > 0.01f);
+		{
+			const bool nf_freq_changed = (fabsf(_notch_filter1_velocity.getNotchFreq() - _param_imu_gyro_nf1_frq.get()) > 0.01f);
+			const bool nf_bw_changed   = (fabsf(_notch_filter1_velocity.getBandwidth() - _param_imu_gyro_nf1_bw.get()) > 0.01f);
 
 			if ((nf1_enabled_prev != nf1_enabled) || (nf1_enabled && (nf_freq_changed || nf_bw_changed))) {
 				_reset_filters = true;
-				break;
 			}
 		}
 
@@ -468,16 +466,23 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 								MODULE_NAME": gyro dynamic notch filter ESC RPM update");
 					}
 
+					if (_dynamic_notch_filter_esc_rpm_apply_perf == nullptr) {
+						_dynamic_notch_filter_esc_rpm_apply_perf = perf_alloc(PC_ELAPSED,
+								MODULE_NAME": gyro dynamic notch filter ESC RPM");
+					}
+
 				} else {
 					_esc_rpm_harmonics = 0;
 
 					perf_free(_dynamic_notch_filter_esc_rpm_disable_perf);
 					perf_free(_dynamic_notch_filter_esc_rpm_init_perf);
 					perf_free(_dynamic_notch_filter_esc_rpm_update_perf);
+					perf_free(_dynamic_notch_filter_esc_rpm_apply_perf);
 
 					_dynamic_notch_filter_esc_rpm_disable_perf = nullptr;
 					_dynamic_notch_filter_esc_rpm_init_perf = nullptr;
 					_dynamic_notch_filter_esc_rpm_update_perf = nullptr;
+					_dynamic_notch_filter_esc_rpm_apply_perf = nullptr;
 				}
 			}
 
@@ -489,6 +494,7 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 			if (_dynamic_notch_filter_fft_disable_perf == nullptr) {
 				_dynamic_notch_filter_fft_disable_perf = perf_alloc(PC_COUNT, MODULE_NAME": gyro dynamic notch filter FFT disable");
 				_dynamic_notch_filter_fft_update_perf = perf_alloc(PC_COUNT, MODULE_NAME": gyro dynamic notch filter FFT update");
+				_dynamic_notch_filter_fft_apply_perf = perf_alloc(PC_ELAPSED, MODULE_NAME": gyro dynamic notch filter FFT");
 			}
 
 		} else {
@@ -535,12 +541,10 @@ void VehicleAngularVelocity::DisableDynamicNotchEscRpm()
 
 	if (_dynamic_notch_filter_esc_rpm) {
 		for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-			for (int axis = 0; axis < 3; axis++) {
-				for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
-					_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].disable();
-					_esc_available.set(esc, false);
-					perf_count(_dynamic_notch_filter_esc_rpm_disable_perf);
-				}
+			for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
+				_dynamic_notch_filter_esc_rpm[harmonic][esc].disable();
+				_esc_available.set(esc, false);
+				perf_count(_dynamic_notch_filter_esc_rpm_disable_perf);
 			}
 		}
 	}
@@ -573,7 +577,7 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 
 	if (enabled && (_esc_status_sub.updated() || force)) {
 
-		bool axis_init[3] {false, false, false};
+		bool filter_init = false;
 
 		esc_status_s esc_status;
 
@@ -600,24 +604,22 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 						const float frequency_hz = math::max(esc_hz * (harmonic + 1), freq_min + (harmonic * 0.5f * bandwidth_hz));
 
 						// update filter parameters if frequency changed or forced
-						for (int axis = 0; axis < 3; axis++) {
-							auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][axis][esc];
+						auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][esc];
 
-							const float notch_freq_delta = fabsf(nf.getNotchFreq() - frequency_hz);
+						const float notch_freq_delta = fabsf(nf.getNotchFreq() - frequency_hz);
 
-							const bool notch_freq_changed = (notch_freq_delta > 0.1f);
+						const bool notch_freq_changed = (notch_freq_delta > 0.1f);
 
-							// only allow initializing one new filter per axis each iteration
-							const bool allow_update = !axis_init[axis] || (nf.initialized() && notch_freq_delta < nf.getBandwidth());
+						// only allow initializing one new filter each iteration
+						const bool allow_update = !filter_init || (nf.initialized() && notch_freq_delta < nf.getBandwidth());
 
-							if ((force_update || notch_freq_changed) && allow_update) {
-								if (nf.setParameters(_filter_sample_rate_hz, frequency_hz, bandwidth_hz)) {
-									perf_count(_dynamic_notch_filter_esc_rpm_update_perf);
+						if ((force_update || notch_freq_changed) && allow_update) {
+							if (nf.setParameters(_filter_sample_rate_hz, frequency_hz, bandwidth_hz)) {
+								perf_count(_dynamic_notch_filter_esc_rpm_update_perf);
 
-									if (!nf.initialized()) {
-										perf_count(_dynamic_notch_filter_esc_rpm_init_perf);
-										axis_init[axis] = true;
-									}
+								if (!nf.initialized()) {
+									perf_count(_dynamic_notch_filter_esc_rpm_init_perf);
+									filter_init = true;
 								}
 							}
 						}
@@ -636,20 +638,18 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 
 				// disable notch filters from highest frequency to lowest
 				for (int harmonic = _esc_rpm_harmonics - 1; harmonic >= 0; harmonic--) {
-					for (int axis = 0; axis < 3; axis++) {
-						auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][axis][esc];
+					auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][esc];
 
-						if (nf.getNotchFreq() > 0.f) {
-							if (nf.initialized() && !axis_init[axis]) {
-								nf.disable();
-								perf_count(_dynamic_notch_filter_esc_rpm_disable_perf);
-								axis_init[axis] = true;
-							}
+					if (nf.getNotchFreq() > 0.f) {
+						if (nf.initialized() && !filter_init) {
+							nf.disable();
+							perf_count(_dynamic_notch_filter_esc_rpm_disable_perf);
+							filter_init = true;
 						}
+					}
 
-						if (nf.getNotchFreq() > 0.f) {
-							all_disabled = false;
-						}
+					if (nf.getNotchFreq() > 0.f) {
+						all_disabled = false;
 					}
 				}
 
@@ -722,60 +722,82 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+Vector3f VehicleAngularVelocity::FilterAngularVelocity(Vector3f data[], int N)
 {
 #if !defined(CONSTRAINED_FLASH)
 
 	// Apply dynamic notch filter from ESC RPM
 	if (_dynamic_notch_filter_esc_rpm) {
+		perf_begin(_dynamic_notch_filter_esc_rpm_apply_perf);
+
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
+					if (_dynamic_notch_filter_esc_rpm[harmonic][esc].getNotchFreq() > 0.f) {
+						_dynamic_notch_filter_esc_rpm[harmonic][esc].applyArray(data, N);
 					}
 				}
 			}
 		}
+
+		perf_end(_dynamic_notch_filter_esc_rpm_apply_perf);
 	}
 
-	// Apply dynamic notch filter from FFT
+	// Apply dynamic notch filter from FFT (peak frequencies differ per axis)
 	if (_dynamic_notch_fft_available) {
-		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
+		perf_begin(_dynamic_notch_filter_fft_apply_perf);
+
+		for (int axis = 0; axis < 3; axis++) {
+			for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
+				auto &nf = _dynamic_notch_filter_fft[axis][peak];
+
+				if (nf.getNotchFreq() > 0.f) {
+					for (int n = 0; n < N; n++) {
+						data[n](axis) = nf.apply(data[n](axis));
+					}
+				}
 			}
 		}
+
+		perf_end(_dynamic_notch_filter_fft_apply_perf);
 	}
 
 #endif // !CONSTRAINED_FLASH
 
+	perf_begin(_filter_apply_perf);
+
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
+	if (_notch_filter0_velocity.getNotchFreq() > 0.f) {
+		_notch_filter0_velocity.applyArray(data, N);
 	}
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
+	if (_notch_filter1_velocity.getNotchFreq() > 0.f) {
+		_notch_filter1_velocity.applyArray(data, N);
 	}
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	_lp_filter_velocity.applyArray(data, N);
+
+	perf_end(_filter_apply_perf);
 
 	// return last filtered sample
 	return data[N - 1];
 }
 
-float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
+Vector3f VehicleAngularVelocity::FilterAngularAcceleration(float inverse_dt_s, const Vector3f data[], int N)
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
-	float angular_acceleration_filtered = 0.f;
+	Vector3f angular_acceleration_filtered;
 
 	for (int n = 0; n < N; n++) {
-		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
-		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
-		_angular_velocity_raw_prev(axis) = data[n];
+		const Vector3f angular_acceleration = (data[n] - _angular_velocity_raw_prev) * inverse_dt_s;
+
+		for (int axis = 0; axis < 3; axis++) {
+			angular_acceleration_filtered(axis) = _lp_filter_acceleration[axis].update(angular_acceleration(axis));
+		}
+
+		_angular_velocity_raw_prev = data[n];
 	}
 
 	return angular_acceleration_filtered;
@@ -833,24 +855,18 @@ void VehicleAngularVelocity::Run()
 			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
 
 			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
-
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
-
-				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
-
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
-					}
+				// copy raw int16 sensor samples to float array for filtering
+				Vector3f data[FIFO_SIZE_MAX];
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+				for (int n = 0; n < N; n++) {
+					data[n] = Vector3f{(float)sensor_fifo_data.x[n], (float)sensor_fifo_data.y[n], (float)sensor_fifo_data.z[n]}
+						  * sensor_fifo_data.scale;
 				}
 
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(data, N)};
+				const Vector3f angular_acceleration_uncalibrated{FilterAngularAcceleration(inverse_dt_s, data, N)};
+
 				// Publish
 				if (!_sensor_gyro_fifo_sub.updated()) {
 					if (CalibrateAndPublish(sensor_fifo_data.timestamp_sample,
@@ -882,19 +898,12 @@ void VehicleAngularVelocity::Run()
 							   0.00002f, 0.02f);
 				_timestamp_sample_last = sensor_data.timestamp_sample;
 
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
-
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// copy sensor sample to array for filtering
+				Vector3f data[1] {Vector3f{sensor_data.x, sensor_data.y, sensor_data.z}};
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
-				}
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(data)};
+				const Vector3f angular_acceleration_uncalibrated{FilterAngularAcceleration(inverse_dt_s, data)};
 
 				// Publish
 				if (!_sensor_sub.updated()) {
@@ -961,13 +970,16 @@ void VehicleAngularVelocity::PrintStatus()
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_filter_reset_perf);
 	perf_print_counter(_selection_changed_perf);
+	perf_print_counter(_filter_apply_perf);
 #if !defined(CONSTRAINED_FLASH)
 	perf_print_counter(_dynamic_notch_filter_esc_rpm_disable_perf);
 	perf_print_counter(_dynamic_notch_filter_esc_rpm_init_perf);
 	perf_print_counter(_dynamic_notch_filter_esc_rpm_update_perf);
+	perf_print_counter(_dynamic_notch_filter_esc_rpm_apply_perf);
 
 	perf_print_counter(_dynamic_notch_filter_fft_disable_perf);
 	perf_print_counter(_dynamic_notch_filter_fft_update_perf);
+	perf_print_counter(_dynamic_notch_filter_fft_apply_perf);
 #endif // CONSTRAINED_FLASH
 }
 
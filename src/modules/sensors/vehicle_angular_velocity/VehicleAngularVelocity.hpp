@@ -78,8 +78,8 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
-	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity(matrix::Vector3f data[], int N = 1);
+	inline matrix::Vector3f FilterAngularAcceleration(float inverse_dt_s, const matrix::Vector3f data[], int N = 1);
 
 	void DisableDynamicNotchEscRpm();
 	void DisableDynamicNotchFFT();
@@ -128,10 +128,10 @@ private:
 
 	float _filter_sample_rate_hz{NAN};
 
-	// angular velocity filters
-	math::LowPassFilter2p<float> _lp_filter_velocity[3] {};
-	math::NotchFilter<float> _notch_filter0_velocity[3] {};
-	math::NotchFilter<float> _notch_filter1_velocity[3] {};
+	// angular velocity filters (all axes share the same coefficients and are processed in one pass)
+	math::LowPassFilter2p<matrix::Vector3f> _lp_filter_velocity{};
+	math::NotchFilter<matrix::Vector3f> _notch_filter0_velocity{};
+	math::NotchFilter<matrix::Vector3f> _notch_filter1_velocity{};
 
 #if !defined(CONSTRAINED_FLASH)
 
@@ -145,7 +145,7 @@ private:
 	// ESC RPM
 	static constexpr int MAX_NUM_ESCS = sizeof(esc_status_s::esc) / sizeof(esc_status_s::esc[0]);
 
-	using NotchFilterHarmonic = math::NotchFilter<float>[3][MAX_NUM_ESCS];
+	using NotchFilterHarmonic = math::NotchFilter<matrix::Vector3f>[MAX_NUM_ESCS];
 	NotchFilterHarmonic *_dynamic_notch_filter_esc_rpm{nullptr};
 
 	int _esc_rpm_harmonics{0};
@@ -155,6 +155,7 @@ private:
 	perf_counter_t _dynamic_notch_filter_esc_rpm_disable_perf{nullptr};
 	perf_counter_t _dynamic_notch_filter_esc_rpm_init_perf{nullptr};
 	perf_counter_t _dynamic_notch_filter_esc_rpm_update_perf{nullptr};
+	perf_counter_t _dynamic_notch_filter_esc_rpm_apply_perf{nullptr};
 
 	// FFT
 	static constexpr int MAX_NUM_FFT_PEAKS = sizeof(sensor_gyro_fft_s::peak_frequencies_x)
@@ -164,6 +165,7 @@ private:
 
 	perf_counter_t _dynamic_notch_filter_fft_disable_perf{nullptr};
 	perf_counter_t _dynamic_notch_filter_fft_update_perf{nullptr};
+	perf_counter_t _dynamic_notch_filter_fft_apply_perf{nullptr};
 
 	bool _dynamic_notch_fft_available{false};
 #endif // !CONSTRAINED_FLASH
@@ -180,6 +182,7 @@ private:
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro filter")};
 	perf_counter_t _filter_reset_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro filter reset")};
 	perf_counter_t _selection_changed_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro selection changed")};
+	perf_counter_t _filter_apply_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro filter notch & low-pass")};
 
 	DEFINE_PARAMETERS(
 #if !defined(CONSTRAINED_FLASH)
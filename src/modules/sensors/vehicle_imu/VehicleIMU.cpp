@@ -299,6 +299,16 @@ bool VehicleIMU::UpdateAccel()
 					_accel_mean_interval_us.update(interval_us);
 					_accel_fifo_mean_interval_us.update(interval_us / math::max(accel.samples, (uint8_t)1));
 
+					// timestamp jitter of the measured (not reconstructed) timestamps: deviation from the interval
+					// expected from the mean raw sample interval
+					if (_accel_fifo_mean_interval_us.valid()) {
+						const float interval_measured_us = interval_us
+										   - (accel.timestamp_sample_correction - _accel_timestamp_sample_correction_last);
+						const float jitter_us = interval_measured_us - math::max(accel.samples, (uint8_t)1) * _accel_fifo_mean_interval_us.mean();
+						_accel_interval_jitter_sum_sq += jitter_us * jitter_us;
+						_accel_interval_jitter_count++;
+					}
+
 					// check measured interval periodically
 					if (_accel_mean_interval_us.valid() && (_accel_mean_interval_us.count() % 10 == 0)) {
 
@@ -350,10 +360,22 @@ bool VehicleIMU::UpdateAccel()
 
 		const float dt = (accel.timestamp_sample - _accel_timestamp_sample_last) * 1e-6f;
 		_accel_timestamp_sample_last = accel.timestamp_sample;
+		_accel_timestamp_sample_correction_last = accel.timestamp_sample_correction;
 
 		const Vector3f accel_raw{accel.x, accel.y, accel.z};
 		_raw_accel_mean.update(accel_raw);
-		_accel_integrator.put(accel_raw, dt);
+
+		// latest angular velocity rotated into the accel sensor frame for the sculling corrections (optional)
+		Vector3f angular_velocity{};
+
+		if (_param_imu_integ_scul.get()) {
+			angular_velocity = _accel_calibration.rotation().transpose() * _gyro_calibration.Correct(_gyro_raw_last);
+		}
+
+		// integrate the raw FIFO samples if available, otherwise the already averaged sensor_accel sample
+		if (!UpdateAccelFIFO(accel, angular_velocity, dt)) {
+			_accel_integrator.put(accel_raw, angular_velocity, dt);
+		}
 
 		updated = true;
 
@@ -407,6 +429,57 @@ bool VehicleIMU::UpdateAccel()
 	return updated;
 }
 
+bool VehicleIMU::UpdateAccelFIFO(const sensor_accel_s &accel, const Vector3f &angular_velocity, float dt)
+{
+	// find the sensor_accel_fifo instance published by the same device (if any),
+	// retry periodically as the driver might not have advertised it yet
+	if ((accel.device_id != _accel_fifo_device_id)
+	    || (!_accel_fifo_available && (hrt_elapsed_time(&_accel_fifo_lookup_last) > 1_s))) {
+
+		_accel_fifo_device_id = accel.device_id;
+		_accel_fifo_lookup_last = hrt_absolute_time();
+		_accel_fifo_available = false;
+		_accel_fifo_pending = false;
+
+		for (uint8_t i = 0; i < ORB_MULTI_MAX_INSTANCES; i++) {
+			uORB::SubscriptionData<sensor_accel_fifo_s> sensor_accel_fifo_sub{ORB_ID(sensor_accel_fifo), i};
+
+			if (sensor_accel_fifo_sub.advertised() && (sensor_accel_fifo_sub.get().device_id == accel.device_id)) {
+				_accel_fifo_available = _sensor_accel_fifo_sub.ChangeInstance(i);
+				break;
+			}
+		}
+	}
+
+	if (!_accel_fifo_available) {
+		return false;
+	}
+
+	// every sensor_accel publication of a FIFO device has a sensor_accel_fifo with the same timestamp_sample,
+	// skip older FIFO data and keep newer data for the next accel sample
+	while (!_accel_fifo_pending || (_accel_fifo.timestamp_sample < accel.timestamp_sample)) {
+		if (!_sensor_accel_fifo_sub.update(&_accel_fifo)) {
+			_accel_fifo_pending = false;
+			return false;
+		}
+
+		_accel_fifo_pending = true;
+	}
+
+	static constexpr uint8_t FIFO_SIZE_MAX = sizeof(_accel_fifo.x) / sizeof(_accel_fifo.x[0]);
+
+	if ((_accel_fifo.timestamp_sample == accel.timestamp_sample) && (_accel_fifo.device_id == accel.device_id)
+	    && (_accel_fifo.samples > 0) && (_accel_fifo.samples <= FIFO_SIZE_MAX)) {
+
+		_accel_integrator.put(_accel_fifo.x, _accel_fifo.y, _accel_fifo.z, _accel_fifo.samples, _accel_fifo.scale,
+				      angular_velocity, dt);
+		_accel_fifo_pending = false;
+		return true;
+	}
+
+	return false;
+}
+
 bool VehicleIMU::UpdateGyro()
 {
 	bool updated = false;
@@ -429,6 +502,16 @@ bool VehicleIMU::UpdateGyro()
 					_gyro_mean_interval_us.update(interval_us);
 					_gyro_fifo_mean_interval_us.update(interval_us / math::max(gyro.samples, (uint8_t)1));
 
+					// timestamp jitter of the measured (not reconstructed) timestamps: deviation from the interval
+					// expected from the mean raw sample interval
+					if (_gyro_fifo_mean_interval_us.valid()) {
+						const float interval_measured_us = interval_us
+										   - (gyro.timestamp_sample_correction - _gyro_timestamp_sample_correction_last);
+						const float jitter_us = interval_measured_us - math::max(gyro.samples, (uint8_t)1) * _gyro_fifo_mean_interval_us.mean();
+						_gyro_interval_jitter_sum_sq += jitter_us * jitter_us;
+						_gyro_interval_jitter_count++;
+					}
+
 					// check measured interval periodically
 					if (_gyro_mean_interval_us.valid() && (_gyro_mean_interval_us.count() % 10 == 0)) {
 						const float interval_mean = _gyro_mean_interval_us.mean();
@@ -459,6 +542,7 @@ bool VehicleIMU::UpdateGyro()
 		const float dt = (gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
 
 		_gyro_timestamp_sample_last = gyro.timestamp_sample;
+		_gyro_timestamp_sample_correction_last = gyro.timestamp_sample_correction;
 		_gyro_timestamp_last = gyro.timestamp;
 
 		_gyro_calibration.set_device_id(gyro.device_id);
@@ -482,7 +566,12 @@ bool VehicleIMU::UpdateGyro()
 
 		const Vector3f gyro_raw{gyro.x, gyro.y, gyro.z};
 		_raw_gyro_mean.update(gyro_raw);
-		_gyro_integrator.put(gyro_raw, dt);
+		_gyro_raw_last = gyro_raw;
+
+		// integrate the raw FIFO samples if available, otherwise the already averaged sensor_gyro sample
+		if (!UpdateGyroFIFO(gyro, dt)) {
+			_gyro_integrator.put(gyro_raw, dt);
+		}
 
 		updated = true;
 
@@ -536,6 +625,56 @@ bool VehicleIMU::UpdateGyro()
 	return updated;
 }
 
+bool VehicleIMU::UpdateGyroFIFO(const sensor_gyro_s &gyro, float dt)
+{
+	// find the sensor_gyro_fifo instance published by the same device (if any),
+	// retry periodically as the driver might not have advertised it yet
+	if ((gyro.device_id != _gyro_fifo_device_id)
+	    || (!_gyro_fifo_available && (hrt_elapsed_time(&_gyro_fifo_lookup_last) > 1_s))) {
+
+		_gyro_fifo_device_id = gyro.device_id;
+		_gyro_fifo_lookup_last = hrt_absolute_time();
+		_gyro_fifo_available = false;
+		_gyro_fifo_pending = false;
+
+		for (uint8_t i = 0; i < ORB_MULTI_MAX_INSTANCES; i++) {
+			uORB::SubscriptionData<sensor_gyro_fifo_s> sensor_gyro_fifo_sub{ORB_ID(sensor_gyro_fifo), i};
+
+			if (sensor_gyro_fifo_sub.advertised() && (sensor_gyro_fifo_sub.get().device_id == gyro.device_id)) {
+				_gyro_fifo_available = _sensor_gyro_fifo_sub.ChangeInstance(i);
+				break;
+			}
+		}
+	}
+
+	if (!_gyro_fifo_available) {
+		return false;
+	}
+
+	// every sensor_gyro publication of a FIFO device has a sensor_gyro_fifo with the same timestamp_sample,
+	// skip older FIFO data and keep newer data for the next gyro sample
+	while (!_gyro_fifo_pending || (_gyro_fifo.timestamp_sample < gyro.timestamp_sample)) {
+		if (!_sensor_gyro_fifo_sub.update(&_gyro_fifo)) {
+			_gyro_fifo_pending = false;
+			return false;
+		}
+
+		_gyro_fifo_pending = true;
+	}
+
+	static constexpr uint8_t FIFO_SIZE_MAX = sizeof(_gyro_fifo.x) / sizeof(_gyro_fifo.x[0]);
+
+	if ((_gyro_fifo.timestamp_sample == gyro.timestamp_sample) && (_gyro_fifo.device_id == gyro.device_id)
+	    && (_gyro_fifo.samples > 0) && (_gyro_fifo.samples <= FIFO_SIZE_MAX)) {
+
+		_gyro_integrator.put(_gyro_fifo.x, _gyro_fifo.y, _gyro_fifo.z, _gyro_fifo.samples, _gyro_fifo.scale, dt);
+		_gyro_fifo_pending = false;
+		return true;
+	}
+
+	return false;
+}
+
 bool VehicleIMU::Publish()
 {
 	bool updated = false;
@@ -586,6 +725,10 @@ bool VehicleIMU::Publish()
 					_status.accel_rate_hz = 1e6f / _accel_mean_interval_us.mean();
 					_status.accel_raw_rate_hz = 1e6f / _accel_fifo_mean_interval_us.mean(); // FIFO
 
+					if (_accel_interval_jitter_count > 0) {
+						_status.accel_timestamp_jitter_us = sqrtf(_accel_interval_jitter_sum_sq / _accel_interval_jitter_count);
+					}
+
 					// accel mean and variance
 					const Dcmf &R = _accel_calibration.rotation();
 					Vector3f(R * _raw_accel_mean.mean()).copyTo(_status.mean_accel);
@@ -610,6 +753,10 @@ bool VehicleIMU::Publish()
 					_status.gyro_rate_hz = 1e6f / _gyro_mean_interval_us.mean();
 					_status.gyro_raw_rate_hz = 1e6f / _gyro_fifo_mean_interval_us.mean(); // FIFO
 
+					if (_gyro_interval_jitter_count > 0) {
+						_status.gyro_timestamp_jitter_us = sqrtf(_gyro_interval_jitter_sum_sq / _gyro_interval_jitter_count);
+					}
+
 					// gyro mean and variance
 					const Dcmf &R = _gyro_calibration.rotation();
 					Vector3f(R * _raw_gyro_mean.mean()).copyTo(_status.mean_gyro);
@@ -643,10 +790,14 @@ bool VehicleIMU::Publish()
 					_raw_accel_mean.reset();
 					_accel_temperature_sum = NAN;
 					_accel_temperature_sum_count = 0;
+					_accel_interval_jitter_sum_sq = 0.f;
+					_accel_interval_jitter_count = 0;
 
 					_raw_gyro_mean.reset();
 					_gyro_temperature_sum = NAN;
 					_gyro_temperature_sum_count = 0;
+					_gyro_interval_jitter_sum_sq = 0.f;
+					_gyro_interval_jitter_count = 0;
 				}
 			}
 
@@ -770,6 +921,16 @@ void VehicleIMU::PrintStatus()
 		     _gyro_calibration.device_id(), (double)_gyro_mean_interval_us.mean(),
 		     (double)_gyro_mean_interval_us.standard_deviation());
 
+	if (_accel_fifo_available) {
+		PX4_INFO_RAW("[vehicle_imu] %" PRIu8 " - Accel FIFO integration, raw interval: %.1f us\n",
+			     _instance, (double)_accel_fifo_mean_interval_us.mean());
+	}
+
+	if (_gyro_fifo_available) {
+		PX4_INFO_RAW("[vehicle_imu] %" PRIu8 " - Gyro FIFO integration, raw interval: %.1f us\n",
+			     _instance, (double)_gyro_fifo_mean_interval_us.mean());
+	}
+
 #if defined(DEBUG_BUILD)
 	PX4_INFO_RAW("[vehicle_imu] %" PRIu8
 		     " - gyro update sample latency: %.1f us (SD %.1f us), publish latency %.1f us (SD %.1f us)\n",
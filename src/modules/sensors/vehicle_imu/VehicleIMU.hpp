@@ -53,7 +53,9 @@
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_accel.h>
+#include <uORB/topics/sensor_accel_fifo.h>
 #include <uORB/topics/sensor_gyro.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_imu_status.h>
@@ -82,7 +84,9 @@ private:
 	void Run() override;
 
 	bool UpdateAccel();
+	bool UpdateAccelFIFO(const sensor_accel_s &accel, const matrix::Vector3f &angular_velocity, float dt);
 	bool UpdateGyro();
+	bool UpdateGyroFIFO(const sensor_gyro_s &gyro, float dt);
 
 	void UpdateIntegratorConfiguration();
 
@@ -107,15 +111,17 @@ private:
 	uORB::SubscriptionMultiArray<estimator_sensor_bias_s> _estimator_sensor_bias_subs{ORB_ID::estimator_sensor_bias};
 
 	uORB::Subscription _sensor_accel_sub;
+	uORB::Subscription _sensor_accel_fifo_sub{ORB_ID(sensor_accel_fifo)};
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub;
+	uORB::Subscription _sensor_gyro_fifo_sub{ORB_ID(sensor_gyro_fifo)};
 
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 
 	calibration::Accelerometer _accel_calibration{};
 	calibration::Gyroscope _gyro_calibration{};
 
-	sensors::Integrator       _accel_integrator{};
-	sensors::IntegratorConing _gyro_integrator{};
+	sensors::IntegratorSculling _accel_integrator{};
+	sensors::IntegratorConing   _gyro_integrator{};
 
 	uint32_t _imu_integration_interval_us{5000};
 
@@ -123,6 +129,23 @@ private:
 	hrt_abstime _gyro_timestamp_sample_last{0};
 	hrt_abstime _gyro_timestamp_last{0};
 
+	int32_t _accel_timestamp_sample_correction_last{0};
+	int32_t _gyro_timestamp_sample_correction_last{0};
+
+	sensor_accel_fifo_s _accel_fifo{};        // most recent sensor_accel_fifo, not yet matched with a sensor_accel sample
+	uint32_t _accel_fifo_device_id{0};        // accel device id the sensor_accel_fifo instance was searched for
+	bool _accel_fifo_available{false};
+	bool _accel_fifo_pending{false};
+	hrt_abstime _accel_fifo_lookup_last{0};
+
+	sensor_gyro_fifo_s _gyro_fifo{};          // most recent sensor_gyro_fifo, not yet matched with a sensor_gyro sample
+	uint32_t _gyro_fifo_device_id{0};         // gyro device id the sensor_gyro_fifo instance was searched for
+	bool _gyro_fifo_available{false};
+	bool _gyro_fifo_pending{false};
+	hrt_abstime _gyro_fifo_lookup_last{0};
+
+	matrix::Vector3f _gyro_raw_last{};        // latest raw gyro sample for the accel sculling corrections
+
 	math::WelfordMeanVector<float, 3> _raw_accel_mean{};
 	math::WelfordMeanVector<float, 3> _raw_gyro_mean{};
 
@@ -147,6 +170,12 @@ private:
 	int _accel_temperature_sum_count{0};
 	int _gyro_temperature_sum_count{0};
 
+	float _accel_interval_jitter_sum_sq{0.f};
+	float _gyro_interval_jitter_sum_sq{0.f};
+
+	int _accel_interval_jitter_count{0};
+	int _gyro_interval_jitter_count{0};
+
 	matrix::Vector3f _acceleration_prev{};     // acceleration from the previous IMU measurement for vibration metrics
 	matrix::Vector3f _angular_velocity_prev{}; // angular velocity from the previous IMU measurement for vibration metrics
 
@@ -200,6 +229,7 @@ private:
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_INTEG_RATE>) _param_imu_integ_rate,
+		(ParamBool<px4::params::IMU_INTEG_SCUL>) _param_imu_integ_scul,
 		(ParamBool<px4::params::SENS_IMU_AUTOCAL>) _param_sens_imu_autocal,
 		(ParamBool<px4::params::SENS_IMU_CLPNOTI>) _param_sens_imu_notify_clipping
 	)
@@ -49,6 +49,18 @@
 */
 PARAM_DEFINE_INT32(IMU_INTEG_RATE, 200);
 
+/**
+* IMU sculling corrections.
+*
+* Apply sculling corrections to the integrated delta velocities, calculated with the latest
+* angular velocity at the accel sample rate. Only the sculling term is applied, the rotation
+* compensation (0.5 * delta angle x delta velocity) is not part of the correction.
+*
+* @boolean
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_INTEG_SCUL, 0);
+
 /**
  * IMU auto calibration
  *
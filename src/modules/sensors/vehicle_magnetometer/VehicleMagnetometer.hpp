@@ -154,7 +154,7 @@ private:
 	hrt_abstime _last_error_message{0};
 	orb_advert_t _mavlink_log_pub{nullptr};
 
-	DataValidatorGroup _voter{1};
+	DataValidatorGroup _voter{1, MAX_SENSOR_COUNT};
 	unsigned _last_failover_count{0};
 
 	uint64_t _timestamp_sample_sum[MAX_SENSOR_COUNT] {};
@@ -67,6 +67,12 @@ VotedSensorsUpdate::VotedSensorsUpdate(bool hil_enabled,
 	parametersUpdate();
 }
 
+VotedSensorsUpdate::~VotedSensorsUpdate()
+{
+	perf_free(_voting_perf);
+	perf_free(_selection_latency_perf);
+}
+
 void VotedSensorsUpdate::initializeSensors()
 {
 	initSensorClass(_gyro, MAX_SENSOR_COUNT);
@@ -140,6 +146,8 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 {
 	const hrt_abstime time_now_us = hrt_absolute_time();
 
+	bool gyro_updated[MAX_SENSOR_COUNT] {};
+
 	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
 		vehicle_imu_s imu_report;
 
@@ -183,6 +191,8 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 
 			_gyro.voter.put(uorb_index, imu_report.timestamp, _last_sensor_data[uorb_index].gyro_rad,
 					imu_status.gyro_error_count, _gyro.priority[uorb_index]);
+
+			gyro_updated[uorb_index] = true;
 		}
 	}
 
@@ -239,6 +249,11 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 		raw.gyro_clipping             = _last_sensor_data[gyro_best_index].gyro_clipping;
 		raw.gyro_calibration_count    = _last_sensor_data[gyro_best_index].gyro_calibration_count;
 
+		if (gyro_updated[gyro_best_index]) {
+			// time from the selected gyro sample until it is available in sensor_combined
+			perf_set_elapsed(_selection_latency_perf, hrt_elapsed_time(&raw.timestamp));
+		}
+
 		if ((accel_best_index != _accel.last_best_vote) || (_selection.accel_device_id != _accel_device_id[accel_best_index])) {
 			_accel.last_best_vote = (uint8_t)accel_best_index;
 			_selection.accel_device_id = _accel_device_id[accel_best_index];
@@ -394,14 +409,21 @@ void VotedSensorsUpdate::printStatus()
 	PX4_INFO_RAW("\n");
 	PX4_INFO_RAW("selected accel: %" PRIu32 " (%" PRIu8 ")\n", _selection.accel_device_id, _accel.last_best_vote);
 	_accel.voter.print();
+
+	PX4_INFO_RAW("\n");
+	perf_print_counter(_voting_perf);
+	perf_print_counter(_selection_latency_perf);
 }
 
 void VotedSensorsUpdate::sensorsPoll(sensor_combined_s &raw)
 {
+	perf_begin(_voting_perf);
+
 	imuPoll(raw);
 
-	calcAccelInconsistency();
-	calcGyroInconsistency();
+	calcInconsistency();
+
+	perf_end(_voting_perf);
 
 	sensors_status_imu_s status{};
 	status.accel_device_id_primary = _selection.accel_device_id;
@@ -446,52 +468,48 @@ void VotedSensorsUpdate::setRelativeTimestamps(sensor_combined_s &raw)
 	}
 }
 
-void VotedSensorsUpdate::calcAccelInconsistency()
+void VotedSensorsUpdate::calcInconsistency()
 {
 	Vector3f accel_mean{};
-	Vector3f accel_all[MAX_SENSOR_COUNT] {};
+	Vector3f gyro_mean{};
 	uint8_t accel_count = 0;
+	uint8_t gyro_count = 0;
+
+	bool accel_valid[MAX_SENSOR_COUNT];
+	bool gyro_valid[MAX_SENSOR_COUNT];
 
 	for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-		if ((_accel_device_id[sensor_index] != 0) && (_accel.priority[sensor_index] > 0)) {
+		accel_valid[sensor_index] = (_accel_device_id[sensor_index] != 0) && (_accel.priority[sensor_index] > 0);
+		gyro_valid[sensor_index] = (_gyro_device_id[sensor_index] != 0) && (_gyro.priority[sensor_index] > 0);
+
+		if (accel_valid[sensor_index]) {
+			accel_mean += Vector3f{_last_sensor_data[sensor_index].accelerometer_m_s2};
 			accel_count++;
-			accel_all[sensor_index] = Vector3f{_last_sensor_data[sensor_index].accelerometer_m_s2};
-			accel_mean += accel_all[sensor_index];
+		}
+
+		if (gyro_valid[sensor_index]) {
+			gyro_mean += Vector3f{_last_sensor_data[sensor_index].gyro_rad};
+			gyro_count++;
 		}
 	}
 
 	if (accel_count > 0) {
 		accel_mean /= accel_count;
-
-		for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-			if ((_accel_device_id[sensor_index] != 0) && (_accel.priority[sensor_index] > 0)) {
-				_accel_diff[sensor_index] = 0.95f * _accel_diff[sensor_index] + 0.05f * (accel_all[sensor_index] - accel_mean);
-			}
-		}
 	}
-}
 
-void VotedSensorsUpdate::calcGyroInconsistency()
-{
-	Vector3f gyro_mean{};
-	Vector3f gyro_all[MAX_SENSOR_COUNT] {};
-	uint8_t gyro_count = 0;
+	if (gyro_count > 0) {
+		gyro_mean /= gyro_count;
+	}
 
 	for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-		if ((_gyro_device_id[sensor_index] != 0) && (_gyro.priority[sensor_index] > 0)) {
-			gyro_count++;
-			gyro_all[sensor_index] = Vector3f{_last_sensor_data[sensor_index].gyro_rad};
-			gyro_mean += gyro_all[sensor_index];
+		if (accel_valid[sensor_index]) {
+			const Vector3f accel_error = Vector3f{_last_sensor_data[sensor_index].accelerometer_m_s2} - accel_mean;
+			_accel_diff[sensor_index] = 0.95f * _accel_diff[sensor_index] + 0.05f * accel_error;
 		}
-	}
 
-	if (gyro_count > 0) {
-		gyro_mean /= gyro_count;
-
-		for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-			if ((_gyro_device_id[sensor_index] != 0) && (_gyro.priority[sensor_index] > 0)) {
-				_gyro_diff[sensor_index] = 0.95f * _gyro_diff[sensor_index] + 0.05f * (gyro_all[sensor_index] - gyro_mean);
-			}
+		if (gyro_valid[sensor_index]) {
+			const Vector3f gyro_error = Vector3f{_last_sensor_data[sensor_index].gyro_rad} - gyro_mean;
+			_gyro_diff[sensor_index] = 0.95f * _gyro_diff[sensor_index] + 0.05f * gyro_error;
 		}
 	}
 }
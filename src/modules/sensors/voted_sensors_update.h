@@ -45,6 +45,7 @@
 #include <px4_platform_common/events.h>
 #include <px4_platform_common/module_params.h>
 #include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
 #include <mathlib/mathlib.h>
 #include <matrix/math.hpp>
 #include <uORB/Publication.hpp>
@@ -62,6 +63,10 @@
 namespace sensors
 {
 
+// Number of IMUs voted on. The voter itself handles up to DataValidatorGroup::MAX_VALIDATORS (8), but the count is
+// also bounded by the calibration slots (CAL_ACCx/CAL_GYROx, calibration::*::MAX_SENSOR_COUNT), the per-instance
+// fields of sensor_correction, the INS0-3 work queues, estimator_selector_status, sensors_status_imu and
+// ORB_MULTI_MAX_INSTANCES (4 on CONSTRAINED_MEMORY boards), which all have to be raised together.
 static constexpr uint8_t MAX_SENSOR_COUNT = 4;
 
 /**
@@ -77,6 +82,7 @@ public:
 	 * Only when calling init(), they have to be initialized.
 	 */
 	VotedSensorsUpdate(bool hil_enabled, uORB::SubscriptionCallbackWorkItem(&vehicle_imu_sub)[MAX_SENSOR_COUNT]);
+	~VotedSensorsUpdate();
 
 	/**
 	 * This tries to find new sensor instances. This is called from init(), then it can be called periodically.
@@ -111,7 +117,7 @@ private:
 		explicit SensorData(ORB_ID meta) : subscription{{meta, 0}, {meta, 1}, {meta, 2}, {meta, 3}} {}
 
 		uORB::Subscription subscription[MAX_SENSOR_COUNT]; /**< raw sensor data subscription */
-		DataValidatorGroup voter{1};
+		DataValidatorGroup voter{1, MAX_SENSOR_COUNT};
 		unsigned int last_failover_count{0};
 		int32_t priority[MAX_SENSOR_COUNT] {};
 		int32_t priority_configured[MAX_SENSOR_COUNT] {};
@@ -137,14 +143,10 @@ private:
 	bool checkFailover(SensorData &sensor, const char *sensor_name, events::px4::enums::sensor_type_t sensor_type);
 
 	/**
-	 * Calculates the magnitude in m/s/s of the largest difference between each accelerometer vector and the mean of all vectors
+	 * Calculates the difference between each accelerometer (m/s/s) and gyro (rad/s) vector and the mean of all vectors,
+	 * for all IMUs in a single pass
 	 */
-	void calcAccelInconsistency();
-
-	/**
-	 * Calculates the magnitude in rad/s of the largest difference between each gyro vector and the mean of all vectors
-	 */
-	void calcGyroInconsistency();
+	void calcInconsistency();
 
 	SensorData _accel{ORB_ID::sensor_accel};
 	SensorData _gyro{ORB_ID::sensor_gyro};
@@ -178,6 +180,9 @@ private:
 
 	bool _parameter_update{false};
 
+	perf_counter_t _voting_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": voting")};
+	perf_counter_t _selection_latency_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": selection latency")};
+
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::SENS_IMU_MODE>) _param_sens_imu_mode
 	)
@@ -0,0 +1,197 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file latency.cpp
+ *
+ * CLI to show the end-to-end control latency (gyro sample to output latch) of the output drivers
+ */
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/time.h>
+#include <uORB/SubscriptionMultiArray.hpp>
+#include <uORB/topics/control_latency.h>
+
+using namespace time_literals;
+
+extern "C" __EXPORT int latency_main(int argc, char *argv[]);
+
+struct LatencyStatistics {
+	uint64_t sum{0};
+	uint32_t count{0};
+	uint32_t min{UINT32_MAX};
+	uint32_t max{0};
+	uint32_t histogram[control_latency_s::HISTOGRAM_BINS] {};
+	bool hardware_latch{false};
+	char param_prefix[sizeof(control_latency_s::param_prefix)] {};
+};
+
+static void print_statistics(int instance, const LatencyStatistics &stats);
+static void usage(const char *reason);
+
+static void print_statistics(int instance, const LatencyStatistics &stats)
+{
+	PX4_INFO_RAW("instance %d (%s), %s, %" PRIu32 " samples\n", instance, stats.param_prefix,
+		     stats.hardware_latch ? "hardware latch" : "driver update", stats.count);
+	PX4_INFO_RAW("  min: %" PRIu32 " us, mean: %.1f us, max: %" PRIu32 " us\n", stats.min,
+		     (double)stats.sum / stats.count, stats.max);
+
+	uint32_t max_bin_count = 0;
+
+	for (auto bin_count : stats.histogram) {
+		max_bin_count = math::max(max_bin_count, bin_count);
+	}
+
+	static constexpr int BAR_WIDTH = 40;
+
+	for (int bin = 0; bin < control_latency_s::HISTOGRAM_BINS; bin++) {
+		const uint32_t lower_us = bin * control_latency_s::HISTOGRAM_BIN_WIDTH_US;
+		const int bar = (stats.histogram[bin] * BAR_WIDTH + max_bin_count - 1) / max_bin_count;
+		const float percent = 100.f * stats.histogram[bin] / stats.count;
+
+		if (bin == control_latency_s::HISTOGRAM_BINS - 1) {
+			PX4_INFO_RAW("  %5" PRIu32 "+      us: %5.1f%% %.*s\n", lower_us, (double)percent, bar,
+				     "########################################");
+
+		} else {
+			PX4_INFO_RAW("  %5" PRIu32 "-%5" PRIu32 " us: %5.1f%% %.*s\n", lower_us,
+				     lower_us + control_latency_s::HISTOGRAM_BIN_WIDTH_US, (double)percent, bar,
+				     "########################################");
+		}
+	}
+}
+
+static void usage(const char *reason)
+{
+	if (reason != nullptr) {
+		PX4_WARN("%s", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Show the end-to-end control latency of all output drivers, from the gyro sample the outputs are based on
+to the time the driver latched the new values into the hardware.
+
+The `control_latency` topics published by the output drivers are accumulated over the given duration and
+printed as a histogram. This can be used to compare work queue configurations and output protocols
+(e.g. DShot vs. OneShot).
+
+### Example
+$ latency -d 10
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("latency", "command");
+	PRINT_MODULE_USAGE_PARAM_INT('d', 5, 1, 600, "Duration in seconds to accumulate", true);
+}
+
+int latency_main(int argc, char *argv[])
+{
+	int duration_s = 5;
+	int ch;
+
+	int myoptind = 1;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "d:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'd':
+			duration_s = (int)strtol(myoptarg, nullptr, 0);
+
+			if (duration_s < 1) {
+				usage("duration invalid");
+				return 1;
+			}
+
+			break;
+
+		default:
+			usage(nullptr);
+			return 1;
+		}
+	}
+
+	uORB::SubscriptionMultiArray<control_latency_s> control_latency_subs{ORB_ID::control_latency};
+
+	if (!control_latency_subs.advertised()) {
+		PX4_WARN("no control latency published (no motor outputs configured or not running?)");
+		return 1;
+	}
+
+	LatencyStatistics stats[control_latency_subs.size()] {};
+
+	PX4_INFO("accumulating for %d s", duration_s);
+
+	const hrt_abstime time_started = hrt_absolute_time();
+
+	while (hrt_elapsed_time(&time_started) < (hrt_abstime)duration_s * 1_s) {
+		for (int i = 0; i < control_latency_subs.size(); i++) {
+			control_latency_s control_latency;
+
+			if (control_latency_subs[i].update(&control_latency) && (control_latency.count > 0)) {
+				LatencyStatistics &s = stats[i];
+				s.sum += (uint64_t)(control_latency.latency_mean_us * control_latency.count + 0.5f);
+				s.count += control_latency.count;
+				s.min = math::min(s.min, control_latency.latency_min_us);
+				s.max = math::max(s.max, control_latency.latency_max_us);
+				s.hardware_latch = control_latency.hardware_latch;
+				memcpy(s.param_prefix, control_latency.param_prefix, sizeof(s.param_prefix) - 1);
+
+				for (int bin = 0; bin < control_latency_s::HISTOGRAM_BINS; bin++) {
+					s.histogram[bin] += control_latency.histogram[bin];
+				}
+			}
+		}
+
+		px4_usleep(100_ms);
+	}
+
+	bool any_samples = false;
+
+	for (int i = 0; i < control_latency_subs.size(); i++) {
+		if (stats[i].count > 0) {
+			print_statistics(i, stats[i]);
+			any_samples = true;
+		}
+	}
+
+	if (!any_samples) {
+		PX4_WARN("no samples received (outputs not updated?)");
+		return 1;
+	}
+
+	return 0;
+}
@@ -99,15 +99,21 @@ private:
 	bool time_matrix_quaternion();
 	bool time_matrix_dcm();
 	bool time_matrix_pseduo_inverse();
+	bool time_matrix_fused_operations();
 
 	void reset();
 
 	matrix::Quatf q;
 	matrix::Eulerf e;
 	matrix::Dcmf d;
+	matrix::Vector3f v;
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+	matrix::SquareMatrix<float, 10> A10;
+	matrix::SquareMatrix<float, 10> P10;
+	matrix::SquareMatrix<float, 10> Q10;
+	matrix::Matrix<float, 10, 3> B10;
 };
 
 bool MicroBenchMatrix::run_tests()
@@ -116,6 +122,7 @@ bool MicroBenchMatrix::run_tests()
 	ut_run_test(time_matrix_quaternion);
 	ut_run_test(time_matrix_dcm);
 	ut_run_test(time_matrix_pseduo_inverse);
+	ut_run_test(time_matrix_fused_operations);
 
 	return (_tests_failed == 0);
 }
@@ -135,6 +142,7 @@ void MicroBenchMatrix::reset()
 	q = matrix::Quatf(rand(), rand(), rand(), rand());
 	e = matrix::Eulerf(random(-2.0 * M_PI, 2.0 * M_PI), random(-2.0 * M_PI, 2.0 * M_PI), random(-2.0 * M_PI, 2.0 * M_PI));
 	d = q;
+	v = matrix::Vector3f(random(-10.0, 10.0), random(-10.0, 10.0), random(-10.0, 10.0));
 
 	for (size_t j = 0; j < 6; j++) {
 		for (size_t i = 0; i < 16; i++) {
@@ -145,6 +153,20 @@ void MicroBenchMatrix::reset()
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
 	}
+
+	for (size_t i = 0; i < 10; i++) {
+		for (size_t j = 0; j < 10; j++) {
+			A10(i, j) = random(-1.0, 1.0);
+			P10(i, j) = random(-1.0, 1.0);
+		}
+
+		for (size_t j = 0; j < 3; j++) {
+			B10(i, j) = random(-1.0, 1.0);
+		}
+	}
+
+	Q10 = P10;
+	P10 = P10.multiplyByTranspose(Q10);
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -158,6 +180,8 @@ bool MicroBenchMatrix::time_matrix_quaternion()
 {
 	PERF("matrix Quaternion from Euler", q = e, 100);
 	PERF("matrix Quaternion from Dcm", q = d, 100);
+	PERF("matrix Quaternion rotateVector", v = q.rotateVector(v), 100);
+	PERF("matrix Quaternion rotateVectorInverse", v = q.rotateVectorInverse(v), 100);
 	return true;
 }
 
@@ -175,6 +199,18 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 	return true;
 }
 
+bool MicroBenchMatrix::time_matrix_fused_operations()
+{
+	PERF("matrix 10x10 A * P * A.T (temporaries)", Q10 = A10 * P10 * A10.T(), 100);
+	PERF("matrix 10x10 A * P * A.T (multiplyByTranspose)", Q10 = (A10 * P10).multiplyByTranspose(A10), 100);
+	PERF("matrix 10x10 A * P + P * A.T (temporaries)", Q10 = A10 * P10 + P10 * A10.T(), 100);
+	PERF("matrix 10x10 A * P + P * A.T (addProduct)", Q10.setZero(); Q10.addProduct(A10, P10); Q10.addProductTranspose(P10, A10),
+	     100);
+	PERF("matrix 10x10 P += B * B.T (temporaries)", P10 += B10 * B10.T(), 100);
+	PERF("matrix 10x10 P += B * B.T (addSymmetricProduct)", P10.addSymmetricProduct(B10), 100);
+	return true;
+}
+
 ut_declare_test_c(test_microbench_matrix, MicroBenchMatrix)
 
 } // namespace MicroBenchMatrix
@@ -77,7 +77,8 @@ enum class COMPARE_ERROR_LEVEL {
 static int 	do_save(const char *param_file_name);
 static int	do_save_default();
 static int 	do_load(const char *param_file_name);
-static int	do_import(const char *param_file_name = nullptr);
+static int	do_import(const char *param_file_name);
+static int	do_load_default(bool import);
 static int	do_show(const char *search_string, bool only_changed);
 static int	do_show_for_airframe();
 static int	do_show_all();
@@ -207,7 +208,7 @@ param_main(int argc, char *argv[])
 				return do_load(argv[2]);
 
 			} else {
-				return do_load(param_get_default_file());
+				return do_load_default(false);
 			}
 		}
 
@@ -216,7 +217,7 @@ param_main(int argc, char *argv[])
 				return do_import(argv[2]);
 
 			} else {
-				return do_import();
+				return do_load_default(true);
 			}
 		}
 
@@ -462,10 +463,6 @@ do_load(const char *param_file_name)
 static int
 do_import(const char *param_file_name)
 {
-	if (param_file_name == nullptr) {
-		param_file_name = param_get_default_file();
-	}
-
 	int fd = -1;
 
 	if (param_file_name) { // passing NULL means to select the flash storage
@@ -499,6 +496,32 @@ do_import(const char *param_file_name)
 	return 0;
 }
 
+static int
+do_load_default(bool import)
+{
+	// unlike reading the file directly, this also applies the changes journaled since the file was written
+	const char *param_file_name = param_get_default_file();
+
+	if (param_file_name && import) {
+		PX4_INFO("importing from '%s'", param_file_name);
+	}
+
+	int result = import ? param_import_default() : param_load_default();
+
+	if (result != 0) {
+		if (param_file_name) {
+			PX4_ERR("%s from '%s' failed (%i)", import ? "importing" : "loading", param_file_name, result);
+
+		} else {
+			PX4_ERR("%s failed (%i)", import ? "importing" : "loading", result);
+		}
+
+		return 1;
+	}
+
+	return 0;
+}
+
 static int
 do_save_default()
 {